@@ -0,0 +1,284 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+struct Options {
+    std::string compiler = "c++";
+    std::string include_dir = "include";
+    std::string flags = "-std=c++14";
+    std::string work_dir = ".";
+    std::string kind = "map_chains";
+    std::vector<std::size_t> sizes{ 10, 50, 100, 200 };
+    double budget_seconds = 0.0;
+    double budget_mib = 0.0;
+};
+
+struct Measurement {
+    std::size_t size;
+    double seconds;
+    double max_rss_mib;
+    bool compiled;
+};
+
+std::vector<std::size_t> parse_sizes(const std::string &list) {
+    std::vector<std::size_t> sizes;
+    std::istringstream stream{ list };
+    std::string each;
+
+    while (std::getline(stream, each, ',')) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(each.c_str(), nullptr, 10)));
+    }
+
+    return sizes;
+}
+
+void generate_map_chains(std::ostream &os, std::size_t size) {
+    os << "#include <monads/expected.hpp>\n"
+          "#include <monads/optional.hpp>\n\n"
+          "template <int I>\n"
+          "struct Step {\n"
+          "    int operator()(int x) const noexcept { return x + I; }\n"
+          "};\n\n"
+          "template <int I>\n"
+          "struct Widen {\n"
+          "    long operator()(int x) const noexcept { return static_cast<long>(x) * I; }\n"
+          "};\n\n"
+          "template <int I>\n"
+          "struct Narrow {\n"
+          "    int operator()(long x) const noexcept { return static_cast<int>(x - I); }\n"
+          "};\n\n"
+          "int chains(int seed) {\n"
+          "    int sum = 0;\n";
+
+    for (std::size_t i = 0; i < size; ++i) {
+        os << "    sum += monads::Optional<int>{ monads::InPlaceType{ }, seed }"
+              ".map(Step<" << i << ">{ }).map(Widen<" << i << ">{ })"
+              ".map(Narrow<" << i << ">{ }).unwrap();\n"
+              "    sum += monads::try_invoke(Step<" << i << ">{ }, seed)"
+              ".map(Widen<" << i << ">{ }).map(Narrow<" << i << ">{ }).unwrap();\n";
+    }
+
+    os << "    return sum;\n"
+          "}\n";
+}
+
+void generate_distinct_expected(std::ostream &os, std::size_t size) {
+    os << "#include <monads/expected.hpp>\n\n"
+          "template <int I>\n"
+          "struct Value {\n"
+          "    int value;\n"
+          "};\n\n"
+          "template <int I>\n"
+          "struct Wide {\n"
+          "    Wide(Value<I> v) noexcept : value{ v.value } { }\n\n"
+          "    long value;\n"
+          "};\n\n"
+          "template <int I>\n"
+          "struct Error {\n"
+          "    int code;\n"
+          "};\n\n"
+          "template <int I>\n"
+          "long distinct(int seed) {\n"
+          "    const monads::Expected<Value<I>, Error<I>> expected{\n"
+          "        monads::InPlaceValueType{ }, Value<I>{ seed }\n"
+          "    };\n"
+          "    const monads::Expected<Wide<I>, Error<I>> widened = expected;\n\n"
+          "    return widened\n"
+          "        .map([](const Wide<I> &w) { return w.value + I; })\n"
+          "        .map_error([](const Error<I> &e) { return e.code; })\n"
+          "        .unwrap();\n"
+          "}\n\n"
+          "long instantiate(int seed) {\n"
+          "    long sum = 0;\n";
+
+    for (std::size_t i = 0; i < size; ++i) {
+        os << "    sum += distinct<" << i << ">(seed);\n";
+    }
+
+    os << "    return sum;\n"
+          "}\n";
+}
+
+bool generate(std::ostream &os, const std::string &kind, std::size_t size) {
+    if (kind == "map_chains") {
+        generate_map_chains(os, size);
+    } else if (kind == "distinct_expected") {
+        generate_distinct_expected(os, size);
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool run_command(const std::string &command, Measurement &measurement) {
+    const auto start = std::chrono::steady_clock::now();
+    const pid_t pid = fork();
+
+    if (pid < 0) {
+        return false;
+    } else if (pid == 0) {
+        execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+
+    int status = 0;
+    struct rusage usage;
+
+    if (wait4(pid, &status, 0, &usage) != pid) {
+        return false;
+    }
+
+    const auto stop = std::chrono::steady_clock::now();
+
+    measurement.seconds = std::chrono::duration<double>(stop - start).count();
+#if defined(__APPLE__)
+    measurement.max_rss_mib = static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+    measurement.max_rss_mib = static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+Measurement measure(const Options &options, std::size_t size) {
+    const std::string source = options.work_dir + "/" + options.kind + "_"
+                               + std::to_string(size) + ".cpp";
+    const std::string object = source + ".o";
+    Measurement measurement{ size, 0.0, 0.0, false };
+
+    {
+        std::ofstream file{ source };
+
+        if (!file) {
+            std::cerr << "could not write " << source << '\n';
+
+            return measurement;
+        } else if (!generate(file, options.kind, size)) {
+            std::cerr << "unknown kind " << options.kind << '\n';
+
+            return measurement;
+        }
+    }
+
+    const std::string command = options.compiler + " " + options.flags + " -I"
+                                + options.include_dir + " -c " + source + " -o " + object;
+
+    measurement.compiled = run_command(command, measurement);
+    std::remove(object.c_str());
+
+    return measurement;
+}
+
+bool within_budget(const Options &options, const Measurement &measurement) {
+    return measurement.compiled
+           && (options.budget_seconds <= 0.0 || measurement.seconds <= options.budget_seconds)
+           && (options.budget_mib <= 0.0 || measurement.max_rss_mib <= options.budget_mib);
+}
+
+void print_usage(const char *program) {
+    std::cerr << "usage: " << program
+              << " [--compiler PATH] [--include DIR] [--flags FLAGS]"
+                 " [--work-dir DIR] [--kind map_chains|distinct_expected]"
+                 " [--sizes N,N,...] [--budget-seconds S]"
+                 " [--budget-mib M]\n";
+}
+
+} // namespace
+
+int main(int argc, const char *const argv[]) {
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool has_next = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "--compiler") == 0 && has_next) {
+            options.compiler = argv[++i];
+        } else if (std::strcmp(argv[i], "--include") == 0 && has_next) {
+            options.include_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--flags") == 0 && has_next) {
+            options.flags = argv[++i];
+        } else if (std::strcmp(argv[i], "--work-dir") == 0 && has_next) {
+            options.work_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--kind") == 0 && has_next) {
+            options.kind = argv[++i];
+        } else if (std::strcmp(argv[i], "--sizes") == 0 && has_next) {
+            options.sizes = parse_sizes(argv[++i]);
+        } else if (std::strcmp(argv[i], "--budget-seconds") == 0 && has_next) {
+            options.budget_seconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--budget-mib") == 0 && has_next) {
+            options.budget_mib = std::strtod(argv[++i], nullptr);
+        } else {
+            print_usage(argv[0]);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    bool passed = true;
+
+    std::cout << "{\n  \"kind\": \"" << options.kind << "\",\n  \"compile_time\": [";
+
+    for (std::size_t i = 0; i < options.sizes.size(); ++i) {
+        const Measurement measurement = measure(options, options.sizes[i]);
+        const bool ok = within_budget(options, measurement);
+
+        passed = passed && ok;
+
+        std::cout << (i == 0 ? "\n" : ",\n")
+                  << "    { \"size\": " << measurement.size
+                  << ", \"seconds\": " << measurement.seconds
+                  << ", \"max_rss_mib\": " << measurement.max_rss_mib
+                  << ", \"compiled\": " << (measurement.compiled ? "true" : "false")
+                  << ", \"within_budget\": " << (ok ? "true" : "false") << " }";
+        std::cout.flush();
+    }
+
+    std::cout << "\n  ]\n}\n";
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,295 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "harness.hpp"
+
+#include <monads/algorithm.hpp>
+#include <monads/any_error.hpp>
+#include <monads/expected.hpp>
+#include <monads/latency.hpp>
+#include <monads/static_error.hpp>
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Payload {
+    int values[8];
+};
+
+int add_one(int x) noexcept {
+    return x + 1;
+}
+
+int twice(int x) noexcept {
+    return x * 2;
+}
+
+int negate(int x) noexcept {
+    return -x;
+}
+
+int may_throw(int x) {
+    if (x < 0) {
+        throw std::invalid_argument{ "negative" };
+    }
+
+    return x;
+}
+
+std::vector<monads::Expected<int, int>> make_batch() {
+    std::vector<monads::Expected<int, int>> batch;
+
+    for (int i = 0; i < 256; ++i) {
+        if (i % 5 == 0) {
+            batch.emplace_back(monads::InPlaceErrorType{ }, i);
+        } else {
+            batch.emplace_back(monads::InPlaceValueType{ }, i);
+        }
+    }
+
+    return batch;
+}
+
+} // namespace
+
+BENCHMARK("expected/construct/value") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Expected<int, int> expected{
+            monads::InPlaceValueType{ },
+            bench::opaque(1)
+        };
+        bench::do_not_optimize(expected);
+    }
+}
+
+BENCHMARK("expected/construct/error") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Expected<int, int> expected{
+            monads::InPlaceErrorType{ },
+            bench::opaque(1)
+        };
+        bench::do_not_optimize(expected);
+    }
+}
+
+BENCHMARK("expected/copy") {
+    const monads::Expected<Payload, int> source{
+        monads::InPlaceValueType{ },
+        Payload{ { 1 } }
+    };
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Expected<Payload, int> copy{ bench::opaque(&source)[0] };
+        bench::do_not_optimize(copy);
+    }
+}
+
+BENCHMARK("expected/move") {
+    monads::Expected<std::vector<int>, int> source{ monads::InPlaceValueType{ }, 16, 1 };
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        monads::Expected<std::vector<int>, int> moved{ std::move(source) };
+        bench::do_not_optimize(moved);
+        source.emplace(std::move(moved).unwrap());
+    }
+}
+
+BENCHMARK("expected/map_chain/monads") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Expected<int, int> expected{
+            monads::InPlaceValueType{ },
+            bench::opaque(1)
+        };
+        const auto result = expected.map(add_one).map(twice).map(negate);
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/map_chain/hand") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const int input = bench::opaque(1);
+        const bool is_value = bench::opaque(true);
+        int result = input;
+
+        if (is_value) {
+            result = negate(twice(add_one(input)));
+        }
+
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/try_invoke/success") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::try_invoke(may_throw, bench::opaque(1));
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/try_invoke/error") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::try_invoke(may_throw, bench::opaque(-1));
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/try_invoke/any_error") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::try_invoke<monads::AnyError>(may_throw, bench::opaque(-1));
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/error_code/exception_ptr") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Expected<int, std::exception_ptr> result{
+            monads::InPlaceErrorType{ },
+            std::make_exception_ptr(std::make_error_code(std::errc::timed_out))
+        };
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/error_code/any_error") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Expected<int, monads::AnyError> result{
+            monads::InPlaceErrorType{ },
+            monads::make_any_error<std::error_code>(std::make_error_code(std::errc::timed_out))
+        };
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/constant_error/string") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::make_unexpected<int, std::string>(
+            "invalid argument: value out of range"
+        );
+        bench::do_not_optimize(result.unwrap_error() == "invalid argument: value out of range");
+    }
+}
+
+BENCHMARK("expected/constant_error/static_error") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::make_unexpected<int>(monads::errors::invalid_argument);
+        bench::do_not_optimize(result.unwrap_error() == monads::errors::invalid_argument);
+    }
+}
+
+BENCHMARK("expected/timed_try_invoke/success") {
+    monads::LatencyRecorder<> recorder;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::timed_try_invoke(recorder, may_throw, bench::opaque(1));
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/timed_try_invoke/error") {
+    monads::LatencyRecorder<> recorder;
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::timed_try_invoke(recorder, may_throw, bench::opaque(-1));
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/try_catch/success") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        int result = 0;
+
+        try {
+            result = may_throw(bench::opaque(1));
+        } catch (...) {
+            result = -1;
+        }
+
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("expected/try_catch/error") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::exception_ptr error;
+
+        try {
+            bench::do_not_optimize(may_throw(bench::opaque(-1)));
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        bench::do_not_optimize(error);
+    }
+}
+
+BENCHMARK("expected/partition/push_back") {
+    const auto batch = make_batch();
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::vector<int> values;
+        std::vector<int> errors;
+
+        for (const auto &expected : batch) {
+            if (expected.has_value()) {
+                values.push_back(expected.unwrap());
+            }
+        }
+
+        for (const auto &expected : batch) {
+            if (expected.has_error()) {
+                errors.push_back(expected.unwrap_error());
+            }
+        }
+
+        bench::do_not_optimize(values.data());
+        bench::do_not_optimize(errors.data());
+    }
+}
+
+BENCHMARK("expected/partition/partition_expected") {
+    const auto batch = make_batch();
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::vector<int> values;
+        std::vector<int> errors;
+
+        monads::partition_expected(batch, values, errors);
+
+        bench::do_not_optimize(values.data());
+        bench::do_not_optimize(errors.data());
+    }
+}
@@ -0,0 +1,255 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_BENCH_HARNESS_HPP
+#define MONADS_BENCH_HARNESS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace bench {
+
+template <typename T>
+inline void do_not_optimize(const T &value) noexcept {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+template <typename T>
+inline T opaque(T value) noexcept {
+#if defined(__GNUC__)
+    asm volatile("" : "+m,r"(value) : : "memory");
+#endif
+
+    return value;
+}
+
+inline void clobber_memory() noexcept {
+#if defined(__GNUC__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+inline std::uint64_t read_cycles() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return static_cast<std::uint64_t>(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+struct Options {
+    std::size_t warmup = 3;
+    std::size_t repetitions = 31;
+    std::size_t iterations = 100000;
+    std::string filter;
+};
+
+struct Sample {
+    double nanoseconds;
+    double cycles;
+};
+
+struct Result {
+    std::string name;
+    std::size_t iterations;
+    std::size_t repetitions;
+    std::size_t bytes;
+    Sample min;
+    Sample median;
+    Sample p99;
+};
+
+using Body = std::function<void(std::size_t)>;
+
+struct Benchmark {
+    std::string name;
+    Body body;
+    std::size_t bytes;
+};
+
+inline std::vector<Benchmark>& registry() {
+    static std::vector<Benchmark> benchmarks;
+
+    return benchmarks;
+}
+
+struct Registrar {
+    Registrar(std::string name, Body body, std::size_t bytes = 0) {
+        registry().push_back(Benchmark{ std::move(name), std::move(body), bytes });
+    }
+};
+
+inline Sample time_batch(const Body &body, std::size_t iterations) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint64_t start_cycles = read_cycles();
+
+    body(iterations);
+
+    const std::uint64_t stop_cycles = read_cycles();
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double elapsed = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()
+    );
+    const double n = static_cast<double>(iterations);
+
+    return Sample{ elapsed / n, static_cast<double>(stop_cycles - start_cycles) / n };
+}
+
+inline Sample percentile(std::vector<Sample> samples, double fraction) {
+    const std::size_t index = static_cast<std::size_t>(
+        fraction * static_cast<double>(samples.size() - 1) + 0.5
+    );
+    Sample result;
+
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end(),
+                     [](const Sample &lhs, const Sample &rhs) {
+                         return lhs.nanoseconds < rhs.nanoseconds;
+                     });
+    result.nanoseconds = samples[index].nanoseconds;
+
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end(),
+                     [](const Sample &lhs, const Sample &rhs) {
+                         return lhs.cycles < rhs.cycles;
+                     });
+    result.cycles = samples[index].cycles;
+
+    return result;
+}
+
+inline Result run(const Benchmark &benchmark, const Options &options) {
+    const std::size_t iterations = options.iterations == 0 ? 1 : options.iterations;
+    const std::size_t repetitions = options.repetitions == 0 ? 1 : options.repetitions;
+    std::vector<Sample> samples;
+
+    for (std::size_t i = 0; i < options.warmup; ++i) {
+        time_batch(benchmark.body, iterations);
+    }
+
+    samples.reserve(repetitions);
+
+    for (std::size_t i = 0; i < repetitions; ++i) {
+        samples.push_back(time_batch(benchmark.body, iterations));
+    }
+
+    return Result{
+        benchmark.name,
+        iterations,
+        repetitions,
+        benchmark.bytes,
+        percentile(samples, 0.0),
+        percentile(samples, 0.5),
+        percentile(samples, 0.99)
+    };
+}
+
+inline void write_json_string(std::ostream &os, const std::string &str) {
+    os << '"';
+
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            os << '\\';
+        }
+
+        os << c;
+    }
+
+    os << '"';
+}
+
+inline void write_json_sample(std::ostream &os, const char *key, const Sample &sample) {
+    os << "\"" << key << "\": { \"ns\": " << sample.nanoseconds
+       << ", \"cycles\": " << sample.cycles << " }";
+}
+
+inline void write_json(std::ostream &os, const std::vector<Result> &results) {
+    os << "{\n  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result &result = results[i];
+
+        os << (i == 0 ? "\n" : ",\n") << "    { \"name\": ";
+        write_json_string(os, result.name);
+        os << ", \"iterations\": " << result.iterations
+           << ", \"repetitions\": " << result.repetitions << ", ";
+        write_json_sample(os, "min", result.min);
+        os << ", ";
+        write_json_sample(os, "median", result.median);
+        os << ", ";
+        write_json_sample(os, "p99", result.p99);
+
+        if (result.bytes != 0) {
+            os << ", \"mb_per_s\": "
+               << static_cast<double>(result.bytes) * 1e3 / result.median.nanoseconds;
+        }
+
+        os << " }";
+    }
+
+    os << "\n  ]\n}\n";
+}
+
+} // namespace bench
+
+#define BENCH_CONCAT_IMPL(X, Y) X##Y
+#define BENCH_CONCAT(X, Y) BENCH_CONCAT_IMPL(X, Y)
+
+#define BENCHMARK(NAME) \
+    static void BENCH_CONCAT(bench_function_, __LINE__)(std::size_t); \
+    static const ::bench::Registrar BENCH_CONCAT(bench_registrar_, __LINE__){ \
+        NAME, &BENCH_CONCAT(bench_function_, __LINE__) \
+    }; \
+    static void BENCH_CONCAT(bench_function_, __LINE__)(std::size_t iterations)
+
+#define BENCHMARK_BYTES(NAME, BYTES) \
+    static void BENCH_CONCAT(bench_function_, __LINE__)(std::size_t); \
+    static const ::bench::Registrar BENCH_CONCAT(bench_registrar_, __LINE__){ \
+        NAME, &BENCH_CONCAT(bench_function_, __LINE__), BYTES \
+    }; \
+    static void BENCH_CONCAT(bench_function_, __LINE__)(std::size_t iterations)
+
+#endif
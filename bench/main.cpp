@@ -0,0 +1,102 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "harness.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::size_t parse_count(const char *arg) {
+    return static_cast<std::size_t>(std::strtoull(arg, nullptr, 10));
+}
+
+void print_usage(const char *program) {
+    std::cerr << "usage: " << program
+              << " [--filter SUBSTRING] [--warmup N] [--repetitions N]"
+                 " [--iterations N] [--out FILE]\n";
+}
+
+} // namespace
+
+int main(int argc, const char *const argv[]) {
+    bench::Options options;
+    std::string out;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool has_next = i + 1 < argc;
+
+        if (std::strcmp(argv[i], "--filter") == 0 && has_next) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--warmup") == 0 && has_next) {
+            options.warmup = parse_count(argv[++i]);
+        } else if (std::strcmp(argv[i], "--repetitions") == 0 && has_next) {
+            options.repetitions = parse_count(argv[++i]);
+        } else if (std::strcmp(argv[i], "--iterations") == 0 && has_next) {
+            options.iterations = parse_count(argv[++i]);
+        } else if (std::strcmp(argv[i], "--out") == 0 && has_next) {
+            out = argv[++i];
+        } else {
+            print_usage(argv[0]);
+
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<bench::Result> results;
+
+    for (const bench::Benchmark &benchmark : bench::registry()) {
+        if (benchmark.name.find(options.filter) != std::string::npos) {
+            results.push_back(bench::run(benchmark, options));
+        }
+    }
+
+    if (out.empty()) {
+        bench::write_json(std::cout, results);
+    } else {
+        std::ofstream file{ out };
+
+        if (!file) {
+            std::cerr << "could not open " << out << '\n';
+
+            return EXIT_FAILURE;
+        }
+
+        bench::write_json(file, results);
+    }
+
+    return EXIT_SUCCESS;
+}
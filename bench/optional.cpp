@@ -0,0 +1,175 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "harness.hpp"
+
+#include <monads/optional.hpp>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <optional>
+#endif
+
+namespace {
+
+struct Payload {
+    int values[8];
+};
+
+struct HandOptional {
+    bool has_value;
+    int value;
+};
+
+int add_one(int x) noexcept {
+    return x + 1;
+}
+
+int twice(int x) noexcept {
+    return x * 2;
+}
+
+int negate(int x) noexcept {
+    return -x;
+}
+
+int may_throw(int x) {
+    if (x < 0) {
+        throw std::invalid_argument{ "negative" };
+    }
+
+    return x;
+}
+
+} // namespace
+
+BENCHMARK("optional/construct/monads") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Optional<int> maybe{ monads::InPlaceType{ }, bench::opaque(1) };
+        bench::do_not_optimize(maybe);
+    }
+}
+
+BENCHMARK("optional/construct/hand") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const HandOptional maybe{ true, bench::opaque(1) };
+        bench::do_not_optimize(maybe);
+    }
+}
+
+#if __cplusplus >= 201703L
+BENCHMARK("optional/construct/std") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const std::optional<int> maybe{ std::in_place, bench::opaque(1) };
+        bench::do_not_optimize(maybe);
+    }
+}
+#endif
+
+BENCHMARK("optional/copy/monads") {
+    const monads::Optional<Payload> source{ monads::InPlaceType{ }, Payload{ { 1 } } };
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Optional<Payload> copy{ bench::opaque(&source)[0] };
+        bench::do_not_optimize(copy);
+    }
+}
+
+#if __cplusplus >= 201703L
+BENCHMARK("optional/copy/std") {
+    const std::optional<Payload> source{ std::in_place, Payload{ { 1 } } };
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const std::optional<Payload> copy{ bench::opaque(&source)[0] };
+        bench::do_not_optimize(copy);
+    }
+}
+#endif
+
+BENCHMARK("optional/move/monads") {
+    monads::Optional<std::vector<int>> source{ monads::InPlaceType{ }, 16, 1 };
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        monads::Optional<std::vector<int>> moved{ std::move(source) };
+        bench::do_not_optimize(moved);
+        source.emplace(std::move(moved).unwrap());
+    }
+}
+
+#if __cplusplus >= 201703L
+BENCHMARK("optional/move/std") {
+    std::optional<std::vector<int>> source{ std::in_place, 16, 1 };
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::optional<std::vector<int>> moved{ std::move(source) };
+        bench::do_not_optimize(moved);
+        source.emplace(std::move(*moved));
+    }
+}
+#endif
+
+BENCHMARK("optional/map_chain/monads") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::Optional<int> maybe{ monads::InPlaceType{ }, bench::opaque(1) };
+        const auto result = maybe.map(add_one).map(twice).map(negate);
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("optional/map_chain/hand") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const HandOptional maybe{ true, bench::opaque(1) };
+        HandOptional result{ false, 0 };
+
+        if (maybe.has_value) {
+            result = HandOptional{ true, negate(twice(add_one(maybe.value))) };
+        }
+
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("optional/maybe_invoke/success") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::maybe_invoke(may_throw, bench::opaque(1));
+        bench::do_not_optimize(result);
+    }
+}
+
+BENCHMARK("optional/maybe_invoke/error") {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto result = monads::maybe_invoke(may_throw, bench::opaque(-1));
+        bench::do_not_optimize(result);
+    }
+}
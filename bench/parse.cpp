@@ -0,0 +1,182 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "harness.hpp"
+
+#include <monads/expected.hpp>
+#include <monads/parse.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+
+struct Field {
+    monads::StringView key;
+    std::uint64_t value;
+};
+
+const char VALID[] =
+    "requests=1048576\n" "retries=3\n" "timeout_ms=2500\n" "connections=128\n"
+    "bytes_in=987654321\n" "bytes_out=123456789\n" "errors=0\n" "latency_us=431\n"
+    "queue_depth=17\n" "workers=16\n" "uptime_s=86400\n" "cache_hits=99812\n"
+    "cache_misses=188\n" "evictions=42\n" "restarts=1\n" "version=20180615\n";
+
+const char MALFORMED[] =
+    "requests=1048576\n" "retries=3\n" "timeout_ms:2500\n" "connections=128\n"
+    "bytes_in=987654321\n" "bytes_out=123456789\n" "errors=\n" "latency_us=431\n"
+    "queue_depth=17\n" "workers=16\n" "uptime_s=86400\n" "cache_hits=99812\n"
+    "cache_misses=188\n" "Evictions=42\n" "restarts=1\n" "version=20180615\n";
+
+bool is_key_char(char c) noexcept {
+    return (c >= 'a' && c <= 'z') || c == '_';
+}
+
+auto line_parser() {
+    namespace parse = monads::parse;
+
+    return parse::map(
+        parse::sequence(
+            parse::take_while1([](char c) { return is_key_char(c); }, "key"),
+            parse::character('=', "'='"),
+            parse::unsigned_integer<std::uint64_t>(),
+            parse::character('\n', "newline")
+        ),
+        [](std::tuple<monads::StringView, char, std::uint64_t, char> parsed) {
+            return Field{ std::get<0>(parsed), std::get<2>(parsed) };
+        }
+    );
+}
+
+std::uint64_t parse_with_combinators(monads::StringView input) {
+    static const auto parser = line_parser();
+    std::uint64_t sum = 0;
+
+    while (!input.empty()) {
+        const auto result = parser(input);
+
+        if (result.has_value()) {
+            sum += result.unwrap().first.value;
+            input = result.unwrap().second;
+        } else {
+            const char *const newline = static_cast<const char*>(
+                std::memchr(input.data(), '\n', input.size())
+            );
+            input = input.substr(static_cast<std::size_t>(newline - input.data()) + 1);
+        }
+    }
+
+    return sum;
+}
+
+Field parse_line_or_throw(const char *&cursor, const char *last) {
+    const char *const key = cursor;
+
+    while (cursor != last && is_key_char(*cursor)) {
+        ++cursor;
+    }
+
+    if (cursor == key || cursor == last || *cursor != '=') {
+        throw std::invalid_argument{ "expected key and '='" };
+    }
+
+    const monads::StringView parsed_key{ key, static_cast<std::size_t>(cursor - key) };
+    const char *const digits = ++cursor;
+    std::uint64_t value = 0;
+
+    for (; cursor != last && *cursor >= '0' && *cursor <= '9'; ++cursor) {
+        value = value * 10 + static_cast<std::uint64_t>(*cursor - '0');
+    }
+
+    if (cursor == digits || cursor == last || *cursor != '\n') {
+        throw std::invalid_argument{ "expected unsigned integer and newline" };
+    }
+
+    ++cursor;
+
+    return Field{ parsed_key, value };
+}
+
+std::uint64_t parse_with_exceptions(monads::StringView input) {
+    const char *cursor = input.data();
+    const char *const last = input.data() + input.size();
+    std::uint64_t sum = 0;
+
+    while (cursor != last) {
+        const char *const line = cursor;
+        const auto result = monads::try_invoke(
+            [&cursor, last] { return parse_line_or_throw(cursor, last); }
+        );
+
+        if (result.has_value()) {
+            sum += result.unwrap().value;
+        } else {
+            cursor = static_cast<const char*>(
+                std::memchr(line, '\n', static_cast<std::size_t>(last - line))
+            ) + 1;
+        }
+    }
+
+    return sum;
+}
+
+} // namespace
+
+BENCHMARK_BYTES("parse/combinator/valid", sizeof(VALID) - 1) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::StringView input{ bench::opaque(&VALID[0]), sizeof(VALID) - 1 };
+        bench::do_not_optimize(parse_with_combinators(input));
+    }
+}
+
+BENCHMARK_BYTES("parse/exception/valid", sizeof(VALID) - 1) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::StringView input{ bench::opaque(&VALID[0]), sizeof(VALID) - 1 };
+        bench::do_not_optimize(parse_with_exceptions(input));
+    }
+}
+
+BENCHMARK_BYTES("parse/combinator/malformed", sizeof(MALFORMED) - 1) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::StringView input{ bench::opaque(&MALFORMED[0]), sizeof(MALFORMED) - 1 };
+        bench::do_not_optimize(parse_with_combinators(input));
+    }
+}
+
+BENCHMARK_BYTES("parse/exception/malformed", sizeof(MALFORMED) - 1) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const monads::StringView input{ bench::opaque(&MALFORMED[0]), sizeof(MALFORMED) - 1 };
+        bench::do_not_optimize(parse_with_exceptions(input));
+    }
+}
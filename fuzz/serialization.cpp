@@ -0,0 +1,77 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+struct Row {
+    std::int64_t id;
+    double score;
+    char tag[4];
+};
+
+template <typename T, typename E>
+void view_expected(const std::vector<std::uint64_t> &aligned, std::size_t size) {
+    const auto view = monads::view_expected<T, E>(aligned.data(), size);
+
+    if (view.has_value() && view.unwrap().has_value()) {
+        volatile T copy = view.unwrap().unwrap();
+        static_cast<void>(copy);
+    } else if (view.has_value() && view.unwrap().has_error()) {
+        volatile E copy = view.unwrap().unwrap_error();
+        static_cast<void>(copy);
+    }
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t *data, std::size_t size) {
+    std::vector<std::uint64_t> aligned(size / sizeof(std::uint64_t) + 1);
+    std::memcpy(aligned.data(), data, size);
+
+    view_expected<Row, std::uint16_t>(aligned, size);
+    view_expected<std::uint8_t, std::int64_t>(aligned, size);
+
+    const auto optional = monads::view_optional<std::int32_t>(aligned.data(), size);
+
+    if (optional.has_value() && optional.unwrap().has_value()) {
+        volatile std::int32_t copy = *optional.unwrap();
+        static_cast<void>(copy);
+    }
+
+    return 0;
+}
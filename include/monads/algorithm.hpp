@@ -0,0 +1,263 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_ALGORITHM_HPP
+#define MONADS_ALGORITHM_HPP
+
+#include <monads/expected.hpp>
+#include <monads/optional.hpp>
+
+#include <monads/detail/algorithm.hpp>
+#include <monads/detail/invoke.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace monads {
+
+struct PartitionCounts {
+    std::size_t values;
+    std::size_t errors;
+};
+
+template <typename R, typename V, typename F>
+PartitionCounts partition_expected(R &&range, V &value_out, F &error_out) {
+    using Iterator = detail::range_iterator_t<R>;
+
+    static_assert(std::is_base_of<
+        std::forward_iterator_tag,
+        detail::iterator_concept_t<Iterator>
+    >::value, "partition_expected makes two passes and requires a forward range");
+
+    PartitionCounts counts{ 0, 0 };
+
+    for (const auto &expected : range) {
+        counts.values += static_cast<std::size_t>(expected.has_value());
+        counts.errors += static_cast<std::size_t>(expected.has_error());
+    }
+
+    detail::reserve_additional(value_out, counts.values);
+    detail::reserve_additional(error_out, counts.errors);
+
+    for (auto &&expected : range) {
+        if (expected.has_value()) {
+            value_out.push_back(detail::forward_like<R>(expected.unwrap()));
+        } else if (expected.has_error()) {
+            error_out.push_back(detail::forward_like<R>(expected.unwrap_error()));
+        }
+    }
+
+    return counts;
+}
+
+template <
+    typename I,
+    typename T,
+    typename C,
+    std::enable_if_t<detail::is_invocable<C&, T&&, detail::iterator_reference_t<I>>::value, int> = 0
+>
+std::decay_t<detail::invoke_result_t<C&, T&&, detail::iterator_reference_t<I>>> try_accumulate(
+    I first,
+    I last,
+    T init,
+    C callable
+) {
+    using Result = std::decay_t<detail::invoke_result_t<C&, T&&, detail::iterator_reference_t<I>>>;
+
+    static_assert(detail::is_expected_with_value<Result, T>::value,
+                  "the operation must return Expected<T, E>");
+
+    for (; first != last; ++first) {
+        Result result = detail::invoke(callable, std::move(init), *first);
+
+        if (!result.has_value()) {
+            return result;
+        }
+
+        init = std::move(result).unwrap();
+    }
+
+    return Result{ InPlaceValueType{ }, std::move(init) };
+}
+
+template <
+    typename I,
+    typename T,
+    typename C,
+    std::enable_if_t<detail::is_invocable<C&, T&&, detail::iterator_reference_t<I>>::value, int> = 0
+>
+std::decay_t<detail::invoke_result_t<C&, T&&, detail::iterator_reference_t<I>>> try_reduce(
+    I first,
+    I last,
+    T init,
+    C callable
+) {
+    return try_accumulate(std::move(first), std::move(last), std::move(init),
+                          std::move(callable));
+}
+
+template <
+    typename P,
+    typename I,
+    typename T,
+    typename C,
+    std::enable_if_t<
+        detail::is_random_access_iterator<I>::value
+        && detail::is_invocable<C&, T&&, detail::iterator_reference_t<I>>::value
+        && detail::is_invocable<C&, T&&, T&&>::value,
+        int
+    > = 0
+>
+std::decay_t<detail::invoke_result_t<C&, T&&, detail::iterator_reference_t<I>>> try_reduce(
+    P &pool,
+    I first,
+    I last,
+    T identity,
+    C callable,
+    std::size_t chunk_size = 4096
+) {
+    using Result = std::decay_t<detail::invoke_result_t<C&, T&&, detail::iterator_reference_t<I>>>;
+
+    static_assert(detail::is_expected_with_value<Result, T>::value,
+                  "the operation must return Expected<T, E>");
+
+    const std::size_t length = static_cast<std::size_t>(last - first);
+    const std::size_t width = chunk_size == 0 ? 1 : chunk_size;
+    const std::size_t chunks = (length + width - 1) / width;
+
+    if (chunks <= 1) {
+        return try_accumulate(std::move(first), std::move(last), std::move(identity), callable);
+    }
+
+    std::vector<Optional<Result>> partials(chunks);
+    std::vector<std::exception_ptr> exceptions(chunks);
+    std::atomic<std::size_t> first_failed{ chunks };
+    detail::TaskLatch latch{ chunks };
+
+    const auto fail = [&first_failed](std::size_t chunk) noexcept {
+        std::size_t seen = first_failed.load(std::memory_order_relaxed);
+
+        while (chunk < seen
+               && !first_failed.compare_exchange_weak(seen, chunk, std::memory_order_relaxed)) { }
+    };
+
+    const auto reduce_chunk = [&](std::size_t chunk) {
+        const auto chunk_first = first + static_cast<std::ptrdiff_t>(chunk * width);
+        const auto chunk_last = chunk + 1 == chunks
+            ? last
+            : chunk_first + static_cast<std::ptrdiff_t>(width);
+
+        try {
+            T accumulated = identity;
+
+            for (auto it = chunk_first; it != chunk_last; ++it) {
+                if (first_failed.load(std::memory_order_relaxed) < chunk) {
+                    break;
+                }
+
+                Result result = detail::invoke(callable, std::move(accumulated), *it);
+
+                if (!result.has_value()) {
+                    partials[chunk].emplace(std::move(result));
+                    fail(chunk);
+                    latch.count_down();
+
+                    return;
+                }
+
+                accumulated = std::move(result).unwrap();
+            }
+
+            partials[chunk].emplace(InPlaceValueType{ }, std::move(accumulated));
+        } catch (...) {
+            exceptions[chunk] = std::current_exception();
+            fail(chunk);
+        }
+
+        latch.count_down();
+    };
+
+    std::size_t submitted = 0;
+
+    try {
+        for (; submitted < chunks; ++submitted) {
+            const std::size_t chunk = submitted;
+
+            pool.submit([&reduce_chunk, chunk] { reduce_chunk(chunk); });
+        }
+    } catch (...) {
+        fail(0);
+        latch.count_down(chunks - submitted);
+        latch.wait();
+
+        throw;
+    }
+
+    latch.wait();
+
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+        if (exceptions[chunk]) {
+            std::rethrow_exception(exceptions[chunk]);
+        }
+
+        Result &partial = *partials[chunk];
+
+        if (!partial.has_value()) {
+            return std::move(partial);
+        }
+
+        if (chunk == 0) {
+            identity = std::move(partial).unwrap();
+
+            continue;
+        }
+
+        Result combined = detail::invoke(callable, std::move(identity),
+                                         std::move(partial).unwrap());
+
+        if (!combined.has_value()) {
+            return combined;
+        }
+
+        identity = std::move(combined).unwrap();
+    }
+
+    return Result{ InPlaceValueType{ }, std::move(identity) };
+}
+
+} // namespace monads
+
+#endif
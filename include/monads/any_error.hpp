@@ -0,0 +1,258 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_ANY_ERROR_HPP
+#define MONADS_ANY_ERROR_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/any_error.hpp>
+#include <monads/detail/instrumentation.hpp>
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/try_invoke.hpp>
+
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace monads {
+
+class AnyError {
+public:
+    AnyError() noexcept = default;
+
+    AnyError(const AnyError &other) {
+        if (other.vtable_) {
+            other.vtable_->copy(other.storage_, storage_);
+            vtable_ = other.vtable_;
+        }
+    }
+
+    AnyError(AnyError &&other) noexcept {
+        take(other);
+    }
+
+    ~AnyError() {
+        reset();
+    }
+
+    AnyError& operator=(const AnyError &other) {
+        if (this != &other) {
+            AnyError copy(other);
+
+            reset();
+            take(copy);
+        }
+
+        return *this;
+    }
+
+    AnyError& operator=(AnyError &&other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+
+        return *this;
+    }
+
+    template <
+        typename E,
+        typename ...Ts,
+        std::enable_if_t<std::is_constructible<E, Ts&&...>::value, int> = 0
+    >
+    E& emplace(Ts &&...ts) {
+        static_assert(std::is_same<E, std::decay_t<E>>::value,
+                      "E must be a cv-unqualified object type");
+        static_assert(std::is_copy_constructible<E>::value,
+                      "E must be copy constructible");
+
+        reset();
+        detail::AnyErrorOps<E>::construct(storage_, std::forward<Ts>(ts)...);
+        vtable_ = &detail::AnyErrorOps<E>::table;
+
+        return detail::AnyErrorOps<E>::get(storage_);
+    }
+
+    bool empty() const noexcept {
+        return !vtable_;
+    }
+
+    bool is_inline() const noexcept {
+        return vtable_ && vtable_->is_inline;
+    }
+
+    const char* what() const noexcept {
+        if (!vtable_) {
+            return "monads::AnyError (empty)";
+        }
+
+        return vtable_->what(storage_);
+    }
+
+    const std::type_info& type() const noexcept {
+        if (!vtable_) {
+            return typeid(void);
+        }
+
+        return vtable_->type();
+    }
+
+    // vtables are per type, so the type_info comparison only runs when the
+    // same type has more than one vtable, e.g. across shared libraries
+    template <typename E>
+    bool holds() const noexcept {
+        return vtable_ == &detail::AnyErrorOps<E>::table
+               || (vtable_ && vtable_->type() == typeid(E));
+    }
+
+    template <typename E>
+    E* get_if() noexcept {
+        if (!holds<E>()) {
+            return nullptr;
+        }
+
+        return &detail::AnyErrorOps<E>::get(storage_);
+    }
+
+    template <typename E>
+    const E* get_if() const noexcept {
+        if (!holds<E>()) {
+            return nullptr;
+        }
+
+        return &detail::AnyErrorOps<E>::get(storage_);
+    }
+
+private:
+    void take(AnyError &other) noexcept {
+        if (other.vtable_) {
+            other.vtable_->move(other.storage_, storage_);
+            vtable_ = other.vtable_;
+            other.vtable_ = nullptr;
+        }
+    }
+
+    void reset() noexcept {
+        if (vtable_) {
+            vtable_->destroy(storage_);
+            vtable_ = nullptr;
+        }
+    }
+
+    detail::AnyErrorStorage storage_;
+    const detail::AnyErrorVTable *vtable_ = nullptr;
+};
+
+static_assert(sizeof(AnyError) == detail::ANY_ERROR_INLINE_SIZE + sizeof(void*),
+              "AnyError must be its inline buffer and a vtable pointer");
+
+template <typename E, typename ...Ts>
+AnyError make_any_error(Ts &&...ts) {
+    AnyError error;
+    error.emplace<E>(std::forward<Ts>(ts)...);
+
+    return error;
+}
+
+namespace detail {
+
+inline bool capture_known_exception(const std::exception&, AnyError&, TypeList<>) {
+    return false;
+}
+
+template <typename E, typename ...Es>
+bool capture_known_exception(const std::exception &e, AnyError &error, TypeList<E, Es...>) {
+    if (typeid(e) == typeid(E)) {
+        error.emplace<E>(static_cast<const E&>(e));
+
+        return true;
+    }
+
+    return capture_known_exception(e, error, TypeList<Es...>{ });
+}
+
+template <>
+struct TryInvoker<AnyError> {
+    template <
+        typename C,
+        typename ...Ts,
+        std::enable_if_t<is_invocable<C&&, Ts&&...>::value, int> = 0
+    >
+    Expected<invoke_result_t<C&&, Ts&&...>, AnyError> operator()(
+        C &&callable,
+        Ts &&...ts
+    ) {
+        using Result = invoke_result_t<C&&, Ts&&...>;
+        using Expected = Expected<Result, AnyError>;
+
+        try {
+            return Expected{
+                InPlaceValueType{ },
+                detail::invoke(std::forward<C>(callable), std::forward<Ts>(ts)...)
+            };
+        } catch (const std::exception &e) {
+            Expected result{ InPlaceErrorType{ } };
+            AnyError &error = result.unwrap_error();
+            bool captured = false;
+
+            // copying a payload too large to be inline can throw std::bad_alloc,
+            // in which case the exception is kept in an exception_ptr, which
+            // is inline and cannot throw
+            try {
+                captured = capture_known_exception(e, error, AnyErrorKnownExceptions{ });
+            } catch (const std::bad_alloc&) { }
+
+            if (!captured) {
+                error.emplace<std::exception_ptr>(std::current_exception());
+            }
+
+            record_error<AnyError>(site);
+
+            return result;
+        } catch (...) {
+            record_error<AnyError>(site);
+
+            return Expected{ InPlaceErrorType{ }, make_any_error<std::exception_ptr>(
+                std::current_exception()
+            ) };
+        }
+    }
+
+    ErrorSite site;
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
@@ -0,0 +1,212 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_CIRCUIT_BREAKER_HPP
+#define MONADS_CIRCUIT_BREAKER_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/circuit_breaker.hpp>
+#include <monads/detail/invoke.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+class CircuitOpenError : public std::exception {
+public:
+    CircuitOpenError() noexcept = default;
+
+    virtual ~CircuitOpenError() = default;
+
+    const char* what() const noexcept override {
+        return "monads::CircuitOpenError";
+    }
+};
+
+enum class CircuitState : unsigned char {
+    Closed,
+    Open,
+    HalfOpen
+};
+
+struct CircuitBreakerOptions {
+    double failure_threshold = 0.5;
+    std::size_t minimum_calls = 20;
+    std::chrono::nanoseconds window = std::chrono::seconds{ 10 };
+    std::size_t buckets = 10;
+    std::size_t shards = 16;
+    std::chrono::nanoseconds open_duration = std::chrono::seconds{ 5 };
+};
+
+template <
+    typename E = std::exception_ptr,
+    typename Clock = std::chrono::steady_clock
+>
+class CircuitBreaker {
+public:
+    // errors are recorded against site, the place the breaker was built
+    explicit CircuitBreaker(E open_error, CircuitBreakerOptions options = { },
+                            ErrorSite site = ErrorSite::current())
+    : open_error_(std::move(open_error)), options_{ options }, site_{ site },
+      bucket_width_{ bucket_width(options) },
+      counters_{ options.shards, options.buckets } { }
+
+    CircuitBreaker(const CircuitBreaker &other) = delete;
+
+    CircuitBreaker& operator=(const CircuitBreaker &other) = delete;
+
+    CircuitState state() const noexcept {
+        return state_.load(std::memory_order_acquire);
+    }
+
+    template <
+        typename C,
+        typename ...As,
+        std::enable_if_t<detail::is_invocable<C&&, As&&...>::value, int> = 0
+    >
+    Expected<detail::invoke_result_t<C&&, As&&...>, E> operator()(
+        C &&callable,
+        As &&...args
+    ) {
+        using Result = Expected<detail::invoke_result_t<C&&, As&&...>, E>;
+
+        const std::int64_t now = now_ns();
+        CircuitState current = state();
+        bool is_trial = false;
+
+        if (current == CircuitState::Open) {
+            if (now < open_until_.load(std::memory_order_acquire)
+                || !state_.compare_exchange_strong(current, CircuitState::HalfOpen,
+                                                   std::memory_order_acq_rel)) {
+                return Result{ InPlaceErrorType{ }, open_error_ };
+            }
+
+            is_trial = true;
+        } else if (current == CircuitState::HalfOpen) {
+            return Result{ InPlaceErrorType{ }, open_error_ };
+        }
+
+        Result result = invoke(is_trial, now, std::forward<C>(callable),
+                               std::forward<As>(args)...);
+
+        if (is_trial) {
+            if (result.has_value()) {
+                counters_.clear();
+                state_.store(CircuitState::Closed, std::memory_order_release);
+            } else {
+                trip(now);
+            }
+        } else {
+            const std::int64_t epoch = now / bucket_width_;
+
+            counters_.record(epoch, result.has_value());
+
+            if (!result.has_value() && should_trip(epoch)) {
+                trip(now);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    template <typename C, typename ...As>
+    Expected<detail::invoke_result_t<C&&, As&&...>, E> invoke(
+        bool is_trial,
+        std::int64_t now,
+        C &&callable,
+        As &&...args
+    ) {
+        try {
+            return detail::TryInvoker<E>{ site_ }(
+                std::forward<C>(callable),
+                std::forward<As>(args)...
+            );
+        } catch (...) {
+            // an exception that is not an E must not leave the circuit half-open
+            if (is_trial) {
+                trip(now);
+            }
+
+            throw;
+        }
+    }
+
+    static std::int64_t bucket_width(const CircuitBreakerOptions &options) noexcept {
+        const std::int64_t buckets =
+            static_cast<std::int64_t>(options.buckets == 0 ? 1 : options.buckets);
+        const std::int64_t width = options.window.count() / buckets;
+
+        return width > 0 ? width : 1;
+    }
+
+    static std::int64_t now_ns() noexcept {
+        return static_cast<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now().time_since_epoch()
+            ).count()
+        );
+    }
+
+    bool should_trip(std::int64_t epoch) const noexcept {
+        const auto totals = counters_.totals(epoch);
+        const std::uint64_t calls = totals.successes + totals.failures;
+
+        return calls >= options_.minimum_calls
+               && static_cast<double>(totals.failures)
+                  >= options_.failure_threshold * static_cast<double>(calls);
+    }
+
+    void trip(std::int64_t now) noexcept {
+        open_until_.store(now + options_.open_duration.count(),
+                          std::memory_order_release);
+        state_.store(CircuitState::Open, std::memory_order_release);
+    }
+
+    E open_error_;
+    CircuitBreakerOptions options_;
+    ErrorSite site_;
+    std::int64_t bucket_width_;
+    detail::WindowCounters counters_;
+    std::atomic<CircuitState> state_{ CircuitState::Closed };
+    std::atomic<std::int64_t> open_until_{ 0 };
+};
+
+} // namespace monads
+
+#endif
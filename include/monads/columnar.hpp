@@ -0,0 +1,495 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_COLUMNAR_HPP
+#define MONADS_COLUMNAR_HPP
+
+#include <monads/expected.hpp>
+#include <monads/optional.hpp>
+#include <monads/serialization.hpp>
+
+#include <monads/detail/columnar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+enum class ColumnarError {
+    OpenFailed,
+    WriteFailed,
+    Valueless,
+    Truncated,
+    BadMagic,
+    UnsupportedVersion,
+    ByteOrderMismatch,
+    LayoutMismatch,
+    BadErrorIndices
+};
+
+namespace detail {
+
+inline ColumnarHeader make_columnar_header(SerialKind kind, std::uint64_t count,
+                                           std::size_t value_size,
+                                           std::size_t value_alignment,
+                                           std::uint64_t error_count,
+                                           std::size_t error_size,
+                                           std::size_t error_alignment) noexcept {
+    const ColumnLayout layout = column_layout(count, value_size, error_count, error_size);
+    ColumnarHeader header;
+
+    header.magic = COLUMNAR_MAGIC;
+    header.version = COLUMNAR_VERSION;
+    header.byte_order = native_byte_order();
+    header.kind = static_cast<std::uint8_t>(kind);
+    header.reserved = 0;
+    header.value_size = static_cast<std::uint32_t>(value_size);
+    header.value_alignment = static_cast<std::uint32_t>(value_alignment);
+    header.error_size = static_cast<std::uint32_t>(error_size);
+    header.error_alignment = static_cast<std::uint32_t>(error_alignment);
+    header.count = count;
+    header.error_count = error_count;
+    header.values_offset = layout.values_offset;
+    header.validity_offset = layout.validity_offset;
+    header.error_indices_offset = layout.error_indices_offset;
+    header.errors_offset = layout.errors_offset;
+
+    return header;
+}
+
+inline Expected<ColumnarHeader, ColumnarError> check_columnar_header(
+    const MappedFile &file,
+    SerialKind kind,
+    std::size_t value_size,
+    std::size_t value_alignment,
+    std::size_t error_size,
+    std::size_t error_alignment
+) noexcept {
+    using Result = Expected<ColumnarHeader, ColumnarError>;
+
+    if (file.size() < sizeof(ColumnarHeader)) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::Truncated };
+    }
+
+    ColumnarHeader header;
+    std::memcpy(&header, file.data(), sizeof(ColumnarHeader));
+
+    if (header.magic == COLUMNAR_MAGIC_SWAPPED) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::ByteOrderMismatch };
+    } else if (header.magic != COLUMNAR_MAGIC) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::BadMagic };
+    } else if (header.version != COLUMNAR_VERSION) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::UnsupportedVersion };
+    } else if (header.byte_order != native_byte_order()) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::ByteOrderMismatch };
+    } else if (header.kind != static_cast<std::uint8_t>(kind)
+               || header.value_size != value_size
+               || header.value_alignment != value_alignment
+               || header.error_size != error_size
+               || header.error_alignment != error_alignment) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::LayoutMismatch };
+    }
+
+    const std::uint64_t limit = file.size();
+
+    // every column must fit in the file, which also keeps the layout
+    // arithmetic below from overflowing
+    if (header.count > limit || header.error_count > header.count
+        || header.count > limit / value_size
+        || header.error_count > limit / sizeof(std::uint64_t)
+        || (error_size != 0 && header.error_count > limit / error_size)) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::Truncated };
+    }
+
+    const ColumnLayout layout =
+        column_layout(header.count, value_size, header.error_count, error_size);
+
+    if (header.values_offset != layout.values_offset
+        || header.validity_offset != layout.validity_offset
+        || header.error_indices_offset != layout.error_indices_offset
+        || header.errors_offset != layout.errors_offset) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::LayoutMismatch };
+    } else if (layout.size > limit) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::Truncated };
+    }
+
+    return Result{ InPlaceValueType{ }, header };
+}
+
+inline bool test_bit(const unsigned char *bitmap, std::size_t index) noexcept {
+    return (bitmap[index / 8] >> (index % 8)) & 1;
+}
+
+// the error indices must be exactly the cleared validity bits in increasing
+// order, so that every element holds a value or an error and lookups can
+// binary search them
+inline bool check_error_indices(const MappedFile &file, const ColumnarHeader &header) noexcept {
+    const unsigned char *const validity = file.data() + header.validity_offset;
+    const auto *const indices =
+        reinterpret_cast<const std::uint64_t*>(file.data() + header.error_indices_offset);
+    std::uint64_t next = 0;
+
+    for (std::uint64_t i = 0; i < header.count;) {
+        if (i % 8 == 0 && header.count - i >= 8 && validity[i / 8] == 0xff) {
+            i += 8;
+
+            continue;
+        }
+
+        if (!test_bit(validity, static_cast<std::size_t>(i))) {
+            if (next == header.error_count || indices[next] != i) {
+                return false;
+            }
+
+            ++next;
+        }
+
+        ++i;
+    }
+
+    return next == header.error_count;
+}
+
+template <typename T>
+void write_value_column(ColumnWriter &writer, const T *value) noexcept {
+    if (value) {
+        writer.write(value, sizeof(T));
+    } else {
+        unsigned char zeros[sizeof(T)] = { };
+        writer.write(zeros, sizeof(T));
+    }
+}
+
+} // namespace detail
+
+template <typename T>
+Expected<std::size_t, ColumnarError> write_optional_column(
+    const char *path,
+    const Optional<T> *optionals,
+    std::size_t count
+) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "only trivially copyable payloads can be stored in columns");
+    static_assert(alignof(T) <= detail::COLUMN_ALIGNMENT,
+                  "column payloads must not be over-aligned");
+
+    using Result = Expected<std::size_t, ColumnarError>;
+
+    detail::ColumnWriter writer{ path };
+
+    if (!writer.is_open()) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::OpenFailed };
+    }
+
+    const detail::ColumnarHeader header = detail::make_columnar_header(
+        detail::SerialKind::Optional, count, sizeof(T), alignof(T), 0, 0, 0
+    );
+
+    writer.write(&header, sizeof(header));
+    writer.pad_to(header.values_offset);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        detail::write_value_column(
+            writer,
+            optionals[i].has_value() ? std::addressof(optionals[i].unwrap()) : nullptr
+        );
+    }
+
+    writer.pad_to(header.validity_offset);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        unsigned char bits = 0;
+
+        for (std::size_t j = i; j < count && j < i + 8; ++j) {
+            bits = static_cast<unsigned char>(bits | (optionals[j].has_value() << (j - i)));
+        }
+
+        writer.write(&bits, 1);
+    }
+
+    writer.pad_to(header.errors_offset);
+
+    if (!writer.close()) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::WriteFailed };
+    }
+
+    return Result{ InPlaceValueType{ }, static_cast<std::size_t>(header.errors_offset) };
+}
+
+template <typename T, typename E>
+Expected<std::size_t, ColumnarError> write_expected_column(
+    const char *path,
+    const Expected<T, E> *expecteds,
+    std::size_t count
+) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value
+                  && std::is_trivially_copyable<E>::value,
+                  "only trivially copyable payloads can be stored in columns");
+    static_assert(alignof(T) <= detail::COLUMN_ALIGNMENT
+                  && alignof(E) <= detail::COLUMN_ALIGNMENT,
+                  "column payloads must not be over-aligned");
+
+    using Result = Expected<std::size_t, ColumnarError>;
+
+    std::uint64_t error_count = 0;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (expecteds[i].has_error()) {
+            ++error_count;
+        } else if (!expecteds[i].has_value()) {
+            return Result{ InPlaceErrorType{ }, ColumnarError::Valueless };
+        }
+    }
+
+    detail::ColumnWriter writer{ path };
+
+    if (!writer.is_open()) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::OpenFailed };
+    }
+
+    const detail::ColumnarHeader header = detail::make_columnar_header(
+        detail::SerialKind::Expected, count, sizeof(T), alignof(T),
+        error_count, sizeof(E), alignof(E)
+    );
+
+    writer.write(&header, sizeof(header));
+    writer.pad_to(header.values_offset);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        detail::write_value_column(
+            writer,
+            expecteds[i].has_value() ? std::addressof(expecteds[i].unwrap()) : nullptr
+        );
+    }
+
+    writer.pad_to(header.validity_offset);
+
+    for (std::size_t i = 0; i < count; i += 8) {
+        unsigned char bits = 0;
+
+        for (std::size_t j = i; j < count && j < i + 8; ++j) {
+            bits = static_cast<unsigned char>(bits | (expecteds[j].has_value() << (j - i)));
+        }
+
+        writer.write(&bits, 1);
+    }
+
+    writer.pad_to(header.error_indices_offset);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (expecteds[i].has_error()) {
+            const std::uint64_t index = i;
+            writer.write(&index, sizeof(index));
+        }
+    }
+
+    writer.pad_to(header.errors_offset);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (expecteds[i].has_error()) {
+            writer.write(std::addressof(expecteds[i].unwrap_error()), sizeof(E));
+        }
+    }
+
+    if (!writer.close()) {
+        return Result{ InPlaceErrorType{ }, ColumnarError::WriteFailed };
+    }
+
+    return Result{
+        InPlaceValueType{ },
+        static_cast<std::size_t>(header.errors_offset + error_count * sizeof(E))
+    };
+}
+
+template <typename T>
+class OptionalColumn {
+public:
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "only trivially copyable payloads can be stored in columns");
+    static_assert(alignof(T) <= detail::COLUMN_ALIGNMENT,
+                  "column payloads must not be over-aligned");
+
+    OptionalColumn(OptionalColumn &&other) noexcept = default;
+
+    OptionalColumn& operator=(OptionalColumn &&other) noexcept = default;
+
+    static Expected<OptionalColumn, ColumnarError> open(const char *path) noexcept {
+        using Result = Expected<OptionalColumn, ColumnarError>;
+
+        detail::MappedFile file;
+
+        if (!file.map(path)) {
+            return Result{ InPlaceErrorType{ }, ColumnarError::OpenFailed };
+        }
+
+        const auto header = detail::check_columnar_header(
+            file, detail::SerialKind::Optional, sizeof(T), alignof(T), 0, 0
+        );
+
+        if (!header) {
+            return Result{ InPlaceErrorType{ }, header.unwrap_error() };
+        }
+
+        return Result{ InPlaceValueType{ }, OptionalColumn{ std::move(file), header.unwrap() } };
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    bool has_value(std::size_t index) const noexcept {
+        return detail::test_bit(validity_, index);
+    }
+
+    OptionalView<T> view(std::size_t index) const noexcept {
+        return OptionalView<T>{ has_value(index) ? values_ + index : nullptr };
+    }
+
+    Optional<T> operator[](std::size_t index) const noexcept {
+        return view(index).to_optional();
+    }
+
+private:
+    OptionalColumn(detail::MappedFile file, const detail::ColumnarHeader &header) noexcept
+    : file_{ std::move(file) },
+      values_{ reinterpret_cast<const T*>(file_.data() + header.values_offset) },
+      validity_{ file_.data() + header.validity_offset },
+      size_{ static_cast<std::size_t>(header.count) } { }
+
+    detail::MappedFile file_;
+    const T *values_;
+    const unsigned char *validity_;
+    std::size_t size_;
+};
+
+template <typename T, typename E>
+class ExpectedColumn {
+public:
+    static_assert(std::is_trivially_copyable<T>::value
+                  && std::is_trivially_copyable<E>::value,
+                  "only trivially copyable payloads can be stored in columns");
+    static_assert(alignof(T) <= detail::COLUMN_ALIGNMENT
+                  && alignof(E) <= detail::COLUMN_ALIGNMENT,
+                  "column payloads must not be over-aligned");
+
+    ExpectedColumn(ExpectedColumn &&other) noexcept = default;
+
+    ExpectedColumn& operator=(ExpectedColumn &&other) noexcept = default;
+
+    static Expected<ExpectedColumn, ColumnarError> open(const char *path) noexcept {
+        using Result = Expected<ExpectedColumn, ColumnarError>;
+
+        detail::MappedFile file;
+
+        if (!file.map(path)) {
+            return Result{ InPlaceErrorType{ }, ColumnarError::OpenFailed };
+        }
+
+        const auto header = detail::check_columnar_header(
+            file, detail::SerialKind::Expected, sizeof(T), alignof(T), sizeof(E), alignof(E)
+        );
+
+        if (!header) {
+            return Result{ InPlaceErrorType{ }, header.unwrap_error() };
+        } else if (!detail::check_error_indices(file, header.unwrap())) {
+            return Result{ InPlaceErrorType{ }, ColumnarError::BadErrorIndices };
+        }
+
+        return Result{ InPlaceValueType{ }, ExpectedColumn{ std::move(file), header.unwrap() } };
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    std::size_t error_count() const noexcept {
+        return error_count_;
+    }
+
+    bool has_value(std::size_t index) const noexcept {
+        return detail::test_bit(validity_, index);
+    }
+
+    ExpectedView<T, E> view(std::size_t index) const noexcept {
+        if (has_value(index)) {
+            return ExpectedView<T, E>{ values_ + index, nullptr };
+        }
+
+        const std::uint64_t *const last = error_indices_ + error_count_;
+        const std::uint64_t *const found = std::lower_bound(error_indices_, last, index);
+
+        if (found == last || *found != index) {
+            return ExpectedView<T, E>{ nullptr, nullptr };
+        }
+
+        return ExpectedView<T, E>{ nullptr, errors_ + (found - error_indices_) };
+    }
+
+    // open checked that every element holds a value or an error
+    Expected<T, E> operator[](std::size_t index) const noexcept {
+        const ExpectedView<T, E> element = view(index);
+
+        if (element.has_value()) {
+            return Expected<T, E>{ InPlaceValueType{ }, element.unwrap() };
+        }
+
+        return Expected<T, E>{ InPlaceErrorType{ }, element.unwrap_error() };
+    }
+
+private:
+    ExpectedColumn(detail::MappedFile file, const detail::ColumnarHeader &header) noexcept
+    : file_{ std::move(file) },
+      values_{ reinterpret_cast<const T*>(file_.data() + header.values_offset) },
+      validity_{ file_.data() + header.validity_offset },
+      error_indices_{
+          reinterpret_cast<const std::uint64_t*>(file_.data() + header.error_indices_offset)
+      },
+      errors_{ reinterpret_cast<const E*>(file_.data() + header.errors_offset) },
+      size_{ static_cast<std::size_t>(header.count) },
+      error_count_{ static_cast<std::size_t>(header.error_count) } { }
+
+    detail::MappedFile file_;
+    const T *values_;
+    const unsigned char *validity_;
+    const std::uint64_t *error_indices_;
+    const E *errors_;
+    std::size_t size_;
+    std::size_t error_count_;
+};
+
+} // namespace monads
+
+#endif
@@ -0,0 +1,120 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_ALGORITHM_HPP
+#define MONADS_DETAIL_ALGORITHM_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/common.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+namespace detail {
+
+template <typename C, typename = void>
+struct has_reserve : std::false_type { };
+
+template <typename C>
+struct has_reserve<C, void_t<
+    decltype(std::declval<C&>().reserve(std::declval<C&>().size() + 1))
+>> : std::true_type { };
+
+template <typename C, std::enable_if_t<has_reserve<C>::value, int> = 0>
+void reserve_additional(C &container, std::size_t count) {
+    container.reserve(container.size() + count);
+}
+
+template <typename C, std::enable_if_t<!has_reserve<C>::value, int> = 0>
+void reserve_additional(C&, std::size_t) noexcept { }
+
+template <
+    typename R,
+    typename T,
+    std::enable_if_t<!std::is_lvalue_reference<R>::value, int> = 0
+>
+std::remove_reference_t<T>&& forward_like(T &&t) noexcept {
+    return std::move(t);
+}
+
+template <
+    typename R,
+    typename T,
+    std::enable_if_t<std::is_lvalue_reference<R>::value, int> = 0
+>
+T&& forward_like(T &&t) noexcept {
+    return std::forward<T>(t);
+}
+
+template <typename R, typename T>
+struct is_expected_with_value : std::false_type { };
+
+template <typename T, typename E>
+struct is_expected_with_value<Expected<T, E>, T> : std::true_type { };
+
+template <typename I>
+using is_random_access_iterator =
+    std::is_base_of<std::random_access_iterator_tag, iterator_concept_t<I>>;
+
+class TaskLatch {
+public:
+    explicit TaskLatch(std::size_t count) noexcept : count_{ count } { }
+
+    void count_down(std::size_t n = 1) {
+        const std::lock_guard<std::mutex> guard{ mutex_ };
+        count_ -= n;
+
+        if (count_ == 0) {
+            done_.notify_all();
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        done_.wait(lock, [this] { return count_ == 0; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable done_;
+    std::size_t count_;
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
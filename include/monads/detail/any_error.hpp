@@ -0,0 +1,218 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_ANY_ERROR_HPP
+#define MONADS_DETAIL_ANY_ERROR_HPP
+
+#include <monads/detail/common.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace monads {
+namespace detail {
+
+constexpr std::size_t ANY_ERROR_INLINE_SIZE = 24;
+
+// over-aligned payloads go to the heap, which keeps AnyError at 32 bytes
+constexpr std::size_t ANY_ERROR_INLINE_ALIGNMENT = alignof(void*);
+
+union AnyErrorStorage {
+    alignas(ANY_ERROR_INLINE_ALIGNMENT) unsigned char buffer[ANY_ERROR_INLINE_SIZE];
+    void *heap;
+};
+
+struct AnyErrorVTable {
+    const char* (*what)(const AnyErrorStorage &storage) noexcept;
+    const std::type_info& (*type)() noexcept;
+    void (*copy)(const AnyErrorStorage &from, AnyErrorStorage &to);
+    void (*move)(AnyErrorStorage &from, AnyErrorStorage &to) noexcept;
+    void (*destroy)(AnyErrorStorage &storage) noexcept;
+    bool is_inline;
+};
+
+// moving an AnyError must not throw, so only nothrow movable types go inline
+template <typename E>
+struct is_any_error_inline : std::integral_constant<
+    bool,
+    sizeof(E) <= ANY_ERROR_INLINE_SIZE
+    && alignof(E) <= ANY_ERROR_INLINE_ALIGNMENT
+    && std::is_nothrow_move_constructible<E>::value
+> { };
+
+template <typename E, typename = void>
+struct has_what : std::false_type { };
+
+template <typename E>
+struct has_what<E, void_t<decltype(
+    static_cast<const char*>(std::declval<const E&>().what())
+)>> : std::true_type { };
+
+template <typename E, std::enable_if_t<has_what<E>::value, int> = 0>
+const char* any_error_what(const E &error) noexcept {
+    return error.what();
+}
+
+template <typename E, std::enable_if_t<!has_what<E>::value, int> = 0>
+const char* any_error_what(const E&) noexcept {
+    return typeid(E).name();
+}
+
+// the exception is kept alive by the exception_ptr, so its message is too
+inline const char* any_error_what(const std::exception_ptr &error) noexcept {
+    if (!error) {
+        return "monads::AnyError (null std::exception_ptr)";
+    }
+
+    try {
+        std::rethrow_exception(error);
+    } catch (const std::exception &e) {
+        return e.what();
+    } catch (...) {
+        return "monads::AnyError (unknown exception)";
+    }
+}
+
+template <typename E, bool = is_any_error_inline<E>::value>
+struct AnyErrorOps {
+    static E& get(AnyErrorStorage &storage) noexcept {
+        return *reinterpret_cast<E*>(storage.buffer);
+    }
+
+    static const E& get(const AnyErrorStorage &storage) noexcept {
+        return *reinterpret_cast<const E*>(storage.buffer);
+    }
+
+    template <typename ...Ts>
+    static void construct(AnyErrorStorage &storage, Ts &&...args) {
+        ::new(static_cast<void*>(storage.buffer)) E(std::forward<Ts>(args)...);
+    }
+
+    static const char* what(const AnyErrorStorage &storage) noexcept {
+        return any_error_what(get(storage));
+    }
+
+    static const std::type_info& type() noexcept {
+        return typeid(E);
+    }
+
+    static void copy(const AnyErrorStorage &from, AnyErrorStorage &to) {
+        construct(to, get(from));
+    }
+
+    static void move(AnyErrorStorage &from, AnyErrorStorage &to) noexcept {
+        construct(to, std::move(get(from)));
+        get(from).~E();
+    }
+
+    static void destroy(AnyErrorStorage &storage) noexcept {
+        get(storage).~E();
+    }
+
+    static constexpr AnyErrorVTable table = { &what, &type, &copy, &move, &destroy, true };
+};
+
+template <typename E, bool IsInline>
+constexpr AnyErrorVTable AnyErrorOps<E, IsInline>::table;
+
+template <typename E>
+struct AnyErrorOps<E, false> {
+    static E& get(AnyErrorStorage &storage) noexcept {
+        return *static_cast<E*>(storage.heap);
+    }
+
+    static const E& get(const AnyErrorStorage &storage) noexcept {
+        return *static_cast<const E*>(storage.heap);
+    }
+
+    template <typename ...Ts>
+    static void construct(AnyErrorStorage &storage, Ts &&...args) {
+        storage.heap = new E(std::forward<Ts>(args)...);
+    }
+
+    static const char* what(const AnyErrorStorage &storage) noexcept {
+        return any_error_what(get(storage));
+    }
+
+    static const std::type_info& type() noexcept {
+        return typeid(E);
+    }
+
+    static void copy(const AnyErrorStorage &from, AnyErrorStorage &to) {
+        construct(to, get(from));
+    }
+
+    static void move(AnyErrorStorage &from, AnyErrorStorage &to) noexcept {
+        to.heap = from.heap;
+        from.heap = nullptr;
+    }
+
+    static void destroy(AnyErrorStorage &storage) noexcept {
+        delete &get(storage);
+    }
+
+    static constexpr AnyErrorVTable table = { &what, &type, &copy, &move, &destroy, false };
+};
+
+template <typename E>
+constexpr AnyErrorVTable AnyErrorOps<E, false>::table;
+
+template <typename ...Es>
+struct TypeList { };
+
+// captured by value when the thrown object has exactly one of these types;
+// anything else, including classes derived from them, keeps its dynamic type
+// in a std::exception_ptr
+using AnyErrorKnownExceptions = TypeList<
+    std::exception,
+    std::bad_alloc,
+    std::logic_error,
+    std::invalid_argument,
+    std::domain_error,
+    std::length_error,
+    std::out_of_range,
+    std::runtime_error,
+    std::range_error,
+    std::overflow_error,
+    std::underflow_error,
+    std::system_error
+>;
+
+} // namespace detail
+} // namespace monads
+
+#endif
@@ -0,0 +1,211 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_CIRCUIT_BREAKER_HPP
+#define MONADS_DETAIL_CIRCUIT_BREAKER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace monads {
+namespace detail {
+
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+constexpr std::int64_t EMPTY_EPOCH = std::numeric_limits<std::int64_t>::min();
+
+// held while the winner of an epoch change zeroes the counters
+constexpr std::int64_t RESETTING_EPOCH = EMPTY_EPOCH + 1;
+
+struct alignas(CACHE_LINE_SIZE) CounterSlot {
+    std::atomic<std::int64_t> epoch{ EMPTY_EPOCH };
+    std::atomic<std::uint64_t> successes{ 0 };
+    std::atomic<std::uint64_t> failures{ 0 };
+};
+
+static_assert(alignof(CounterSlot) == CACHE_LINE_SIZE,
+              "CounterSlot must start on a cache line");
+static_assert(sizeof(CounterSlot) == CACHE_LINE_SIZE,
+              "CounterSlot must fill exactly one cache line");
+
+// std::allocator ignores over-alignment before C++17
+template <typename T>
+struct AlignedAllocator {
+    using value_type = T;
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U>&) noexcept { }
+
+    T* allocate(std::size_t n) {
+        if (n > (std::numeric_limits<std::size_t>::max() - OVERHEAD) / sizeof(T)) {
+            throw std::bad_alloc{ };
+        }
+
+#ifdef __cpp_aligned_new
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ alignof(T) }));
+#else
+        // the address from operator new is kept just before the aligned block
+        void *const raw = ::operator new(n * sizeof(T) + OVERHEAD);
+        const std::uintptr_t aligned =
+            (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + alignof(T) - 1)
+            & ~static_cast<std::uintptr_t>(alignof(T) - 1);
+
+        reinterpret_cast<void**>(aligned)[-1] = raw;
+
+        return reinterpret_cast<T*>(aligned);
+#endif
+    }
+
+    void deallocate(T *pointer, std::size_t) noexcept {
+#ifdef __cpp_aligned_new
+        ::operator delete(pointer, std::align_val_t{ alignof(T) });
+#else
+        ::operator delete(reinterpret_cast<void**>(pointer)[-1]);
+#endif
+    }
+
+private:
+    static constexpr std::size_t OVERHEAD = sizeof(void*) + alignof(T) - 1;
+};
+
+template <typename T, typename U>
+bool operator==(const AlignedAllocator<T>&, const AlignedAllocator<U>&) noexcept {
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const AlignedAllocator<T>&, const AlignedAllocator<U>&) noexcept {
+    return false;
+}
+
+inline std::size_t current_shard_hint() noexcept {
+#if defined(__linux__)
+    const int cpu = sched_getcpu();
+
+    if (cpu >= 0) {
+        return static_cast<std::size_t>(cpu);
+    }
+#endif
+
+    thread_local const std::size_t hint =
+        std::hash<std::thread::id>{ }(std::this_thread::get_id());
+
+    return hint;
+}
+
+class WindowCounters {
+public:
+    struct Totals {
+        std::uint64_t successes;
+        std::uint64_t failures;
+    };
+
+    WindowCounters(std::size_t shards, std::size_t buckets)
+    : shards_{ shards == 0 ? 1 : shards }, buckets_{ buckets == 0 ? 1 : buckets },
+      slots_(shards_ * buckets_) { }
+
+    void record(std::int64_t epoch, bool success) noexcept {
+        const std::size_t shard = current_shard_hint() % shards_;
+        CounterSlot &slot = slots_[shard * buckets_ + bucket_of(epoch)];
+        std::int64_t seen = slot.epoch.load(std::memory_order_acquire);
+
+        // the counters are zeroed before the new epoch is published, so an
+        // increment made after observing it is never wiped out; a caller
+        // holding an epoch older than the slot's drops its sample instead
+        while (seen != epoch) {
+            if (seen == RESETTING_EPOCH) {
+                seen = slot.epoch.load(std::memory_order_acquire);
+
+                continue;
+            } else if (seen > epoch) {
+                return;
+            } else if (slot.epoch.compare_exchange_weak(seen, RESETTING_EPOCH,
+                                                        std::memory_order_acquire)) {
+                slot.successes.store(0, std::memory_order_relaxed);
+                slot.failures.store(0, std::memory_order_relaxed);
+                slot.epoch.store(epoch, std::memory_order_release);
+
+                break;
+            }
+        }
+
+        (success ? slot.successes : slot.failures)
+            .fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Totals totals(std::int64_t epoch) const noexcept {
+        const std::int64_t oldest = epoch - static_cast<std::int64_t>(buckets_);
+        Totals sum{ 0, 0 };
+
+        for (const CounterSlot &slot : slots_) {
+            const std::int64_t seen = slot.epoch.load(std::memory_order_relaxed);
+
+            if (seen > oldest && seen <= epoch) {
+                sum.successes += slot.successes.load(std::memory_order_relaxed);
+                sum.failures += slot.failures.load(std::memory_order_relaxed);
+            }
+        }
+
+        return sum;
+    }
+
+    void clear() noexcept {
+        for (CounterSlot &slot : slots_) {
+            slot.epoch.store(EMPTY_EPOCH, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::size_t bucket_of(std::int64_t epoch) const noexcept {
+        return static_cast<std::size_t>(epoch) % buckets_;
+    }
+
+    std::size_t shards_;
+    std::size_t buckets_;
+    std::vector<CounterSlot, AlignedAllocator<CounterSlot>> slots_;
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
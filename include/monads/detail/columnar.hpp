@@ -0,0 +1,231 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_COLUMNAR_HPP
+#define MONADS_DETAIL_COLUMNAR_HPP
+
+#include <monads/detail/serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace monads {
+namespace detail {
+
+constexpr std::uint32_t COLUMNAR_MAGIC = 0x4d4e4443;
+
+constexpr std::uint32_t COLUMNAR_MAGIC_SWAPPED = 0x43444e4d;
+
+constexpr std::uint8_t COLUMNAR_VERSION = 1;
+
+constexpr std::size_t COLUMN_ALIGNMENT = 64;
+
+struct ColumnarHeader {
+    std::uint32_t magic;
+    std::uint8_t version;
+    std::uint8_t byte_order;
+    std::uint8_t kind;
+    std::uint8_t reserved;
+    std::uint32_t value_size;
+    std::uint32_t value_alignment;
+    std::uint32_t error_size;
+    std::uint32_t error_alignment;
+    std::uint64_t count;
+    std::uint64_t error_count;
+    std::uint64_t values_offset;
+    std::uint64_t validity_offset;
+    std::uint64_t error_indices_offset;
+    std::uint64_t errors_offset;
+};
+
+static_assert(sizeof(ColumnarHeader) == 72, "ColumnarHeader must be packed into 72 bytes");
+
+struct ColumnLayout {
+    std::uint64_t values_offset;
+    std::uint64_t validity_offset;
+    std::uint64_t error_indices_offset;
+    std::uint64_t errors_offset;
+    std::uint64_t size;
+};
+
+inline ColumnLayout column_layout(std::uint64_t count, std::size_t value_size,
+                                  std::uint64_t error_count,
+                                  std::size_t error_size) noexcept {
+    ColumnLayout layout;
+
+    layout.values_offset = round_up(sizeof(ColumnarHeader), COLUMN_ALIGNMENT);
+    layout.validity_offset =
+        round_up(layout.values_offset + count * value_size, COLUMN_ALIGNMENT);
+    layout.error_indices_offset =
+        round_up(layout.validity_offset + (count + 7) / 8, COLUMN_ALIGNMENT);
+    layout.errors_offset = round_up(
+        layout.error_indices_offset + error_count * sizeof(std::uint64_t),
+        COLUMN_ALIGNMENT
+    );
+    layout.size = layout.errors_offset + error_count * error_size;
+
+    return layout;
+}
+
+class ColumnWriter {
+public:
+    explicit ColumnWriter(const char *path) noexcept : file_{ std::fopen(path, "wb") } { }
+
+    ColumnWriter(const ColumnWriter &other) = delete;
+
+    ~ColumnWriter() {
+        if (file_) {
+            std::fclose(file_);
+        }
+    }
+
+    ColumnWriter& operator=(const ColumnWriter &other) = delete;
+
+    bool is_open() const noexcept {
+        return file_ != nullptr;
+    }
+
+    void write(const void *data, std::size_t size) noexcept {
+        if (ok_ && size != 0) {
+            ok_ = std::fwrite(data, 1, size, file_) == size;
+            written_ += size;
+        }
+    }
+
+    void pad_to(std::uint64_t offset) noexcept {
+        static const unsigned char zeros[COLUMN_ALIGNMENT] = { };
+
+        while (ok_ && written_ < offset) {
+            const std::uint64_t remaining = offset - written_;
+
+            write(zeros, static_cast<std::size_t>(
+                remaining < COLUMN_ALIGNMENT ? remaining : COLUMN_ALIGNMENT
+            ));
+        }
+    }
+
+    bool close() noexcept {
+        const bool closed = std::fclose(file_) == 0;
+        file_ = nullptr;
+
+        return ok_ && closed;
+    }
+
+private:
+    std::FILE *file_;
+    std::uint64_t written_ = 0;
+    bool ok_ = true;
+};
+
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+
+    MappedFile(const MappedFile &other) = delete;
+
+    MappedFile(MappedFile &&other) noexcept
+    : data_{ std::exchange(other.data_, nullptr) }, size_{ std::exchange(other.size_, 0) } { }
+
+    ~MappedFile() {
+        unmap();
+    }
+
+    MappedFile& operator=(const MappedFile &other) = delete;
+
+    MappedFile& operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+
+        return *this;
+    }
+
+    bool map(const char *path) noexcept {
+        const int fd = ::open(path, O_RDONLY);
+
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat status;
+        void *mapped = MAP_FAILED;
+
+        if (::fstat(fd, &status) == 0 && status.st_size > 0) {
+            mapped = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ,
+                            MAP_SHARED, fd, 0);
+        }
+
+        ::close(fd);
+
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+
+        data_ = static_cast<const unsigned char*>(mapped);
+        size_ = static_cast<std::size_t>(status.st_size);
+
+        return true;
+    }
+
+    const unsigned char* data() const noexcept {
+        return data_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+private:
+    void unmap() noexcept {
+        if (data_) {
+            ::munmap(const_cast<unsigned char*>(data_), size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    const unsigned char *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
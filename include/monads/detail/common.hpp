@@ -32,8 +32,30 @@
 #ifndef MONADS_DETAIL_COMMON_HPP
 #define MONADS_DETAIL_COMMON_HPP
 
+#include <iterator>
+#include <memory>
 #include <type_traits>
 
+#if defined(__cpp_constexpr_dynamic_alloc) && __cplusplus >= 202002L
+#define MONADS_HAS_CONSTEXPR_CONSTRUCT
+#define MONADS_CONSTEXPR20 constexpr
+#else
+#define MONADS_CONSTEXPR20
+#endif
+
+// lets a constant evaluation find the active member of a union, which
+// std::is_within_lifetime will do portably
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated) && __has_builtin(__builtin_constant_p)
+#define MONADS_HAS_ACTIVE_MEMBER_QUERY
+#endif
+#endif
+
+#if !defined(MONADS_NO_CONCEPTS) && defined(__cpp_concepts) \
+    && defined(__cpp_conditional_explicit)
+#define MONADS_HAS_CONCEPTS
+#endif
+
 namespace monads {
 namespace detail {
 
@@ -46,6 +68,49 @@ struct ErrorTag { };
 template <typename ...>
 using void_t = void;
 
+template <typename R>
+using range_iterator_t = decltype(std::begin(std::declval<R&>()));
+
+template <typename I>
+using iterator_reference_t = typename std::iterator_traits<I>::reference;
+
+// the traversal an iterator supports, which iterator_concept can report as
+// stronger than iterator_category when the reference is a prvalue
+template <typename I, typename = void>
+struct iterator_concept {
+    using type = typename std::iterator_traits<I>::iterator_category;
+};
+
+template <typename I>
+struct iterator_concept<I, void_t<typename I::iterator_concept>> {
+    using type = typename I::iterator_concept;
+};
+
+template <typename I>
+using iterator_concept_t = typename iterator_concept<I>::type;
+
+template <bool ...Bs>
+struct BoolPack { };
+
+template <bool ...Bs>
+struct all_of : std::is_same<BoolPack<true, Bs...>, BoolPack<Bs..., true>> { };
+
+template <typename T>
+struct is_trivially_replaceable : std::integral_constant<
+    bool,
+    std::is_trivially_copy_constructible<T>::value
+    && std::is_trivially_copy_assignable<T>::value
+    && std::is_trivially_destructible<T>::value
+> { };
+
+template <typename T, std::enable_if_t<std::is_trivially_destructible<T>::value, int> = 0>
+constexpr void destroy(T&) noexcept { }
+
+template <typename T, std::enable_if_t<!std::is_trivially_destructible<T>::value, int> = 0>
+MONADS_CONSTEXPR20 void destroy(T &object) noexcept {
+    object.~T();
+}
+
 } // namespace detail
 } // namespace monads
 
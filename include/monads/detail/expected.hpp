@@ -33,7 +33,10 @@
 #define MONADS_DETAIL_EXPECTED_HPP
 
 #include <monads/detail/common.hpp>
+#include <monads/detail/special_members.hpp>
 
+#include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -47,8 +50,13 @@ enum class ExpectedState {
     Error
 };
 
-template <typename T, typename E, typename = void>
-struct ExpectedStorage {
+template <
+    typename T,
+    typename E,
+    bool = std::is_trivially_destructible<T>::value
+           && std::is_trivially_destructible<E>::value
+>
+struct ExpectedUnion {
     union {
         Monostate monostate;
         T value;
@@ -57,28 +65,21 @@ struct ExpectedStorage {
 
     ExpectedState state = ExpectedState::Monostate;
 
-    constexpr ExpectedStorage() noexcept : monostate{ } { }
+    constexpr ExpectedUnion() noexcept : monostate{ } { }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0>
-    constexpr ExpectedStorage(ValueTag, Ts &&...args)
+    constexpr ExpectedUnion(ValueTag, Ts &&...args)
     noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
     : value(std::forward<Ts>(args)...), state{ ExpectedState::Value } { }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<E, Ts&&...>::value, int> = 0>
-    constexpr ExpectedStorage(ErrorTag, Ts &&...args)
+    constexpr ExpectedUnion(ErrorTag, Ts &&...args)
     noexcept(std::is_nothrow_constructible<E, Ts&&...>::value)
-    : error(std::forward<Ts>(args)...), state{ ExpectedState::Value } { }
-
-    constexpr void reset() noexcept {
-        state = ExpectedState::Monostate;
-    }
+    : error(std::forward<Ts>(args)...), state{ ExpectedState::Error } { }
 };
 
 template <typename T, typename E>
-struct ExpectedStorage<T, E, void_t<std::enable_if_t<
-    !std::is_trivially_destructible<T>::value
-    || !std::is_trivially_destructible<E>::value
->>> {
+struct ExpectedUnion<T, E, false> {
     union {
         Monostate monostate;
         T value;
@@ -87,33 +88,179 @@ struct ExpectedStorage<T, E, void_t<std::enable_if_t<
 
     ExpectedState state = ExpectedState::Monostate;
 
-    constexpr ExpectedStorage() noexcept : monostate{ } { }
+    constexpr ExpectedUnion() noexcept : monostate{ } { }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0>
-    constexpr ExpectedStorage(ValueTag, Ts &&...args)
+    constexpr ExpectedUnion(ValueTag, Ts &&...args)
     noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
     : value(std::forward<Ts>(args)...), state{ ExpectedState::Value } { }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<E, Ts&&...>::value, int> = 0>
-    constexpr ExpectedStorage(ErrorTag, Ts &&...args)
+    constexpr ExpectedUnion(ErrorTag, Ts &&...args)
     noexcept(std::is_nothrow_constructible<E, Ts&&...>::value)
     : error(std::forward<Ts>(args)...), state{ ExpectedState::Error } { }
 
-    ~ExpectedStorage() {
-        reset();
-    }
-
-    void reset() noexcept {
+    MONADS_CONSTEXPR20 ~ExpectedUnion() {
         if (state == ExpectedState::Value) {
-            value.T::~T();
+            detail::destroy(value);
         } else if (state == ExpectedState::Error) {
-            error.E::~E();
+            detail::destroy(error);
+        }
+    }
+};
+
+template <typename T, typename E>
+struct ExpectedStorage : ExpectedUnion<T, E> {
+    using ExpectedUnion<T, E>::ExpectedUnion;
+
+    constexpr bool has_value() const noexcept {
+        return this->state == ExpectedState::Value;
+    }
+
+    constexpr bool has_error() const noexcept {
+        return this->state == ExpectedState::Error;
+    }
+
+    template <typename ...Ts>
+    constexpr T& construct(ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+#ifdef MONADS_HAS_CONSTEXPR_CONSTRUCT
+        std::construct_at(std::addressof(this->value), std::forward<Ts>(args)...);
+        this->state = ExpectedState::Value;
+#else
+        construct_impl(IsTriviallyReplaceable{ }, ValueTag{ }, std::forward<Ts>(args)...);
+#endif
+
+        return this->value;
+    }
+
+    template <typename ...Ts>
+    constexpr E& construct(ErrorTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<E, Ts&&...>::value) {
+#ifdef MONADS_HAS_CONSTEXPR_CONSTRUCT
+        std::construct_at(std::addressof(this->error), std::forward<Ts>(args)...);
+        this->state = ExpectedState::Error;
+#else
+        construct_impl(IsTriviallyReplaceable{ }, ErrorTag{ }, std::forward<Ts>(args)...);
+#endif
+
+        return this->error;
+    }
+
+    constexpr T& get(ValueTag) noexcept {
+        return this->value;
+    }
+
+    constexpr const T& get(ValueTag) const noexcept {
+        return this->value;
+    }
+
+    constexpr E& get(ErrorTag) noexcept {
+        return this->error;
+    }
+
+    constexpr const E& get(ErrorTag) const noexcept {
+        return this->error;
+    }
+
+    constexpr void reset() noexcept {
+        if (this->state == ExpectedState::Value) {
+            detail::destroy(this->value);
+        } else if (this->state == ExpectedState::Error) {
+            detail::destroy(this->error);
         }
 
-        state = ExpectedState::Monostate;
+        this->state = ExpectedState::Monostate;
+    }
+
+    constexpr void construct_from(const ExpectedStorage &other)
+    noexcept(std::is_nothrow_copy_constructible<T>::value
+             && std::is_nothrow_copy_constructible<E>::value) {
+        if (other.has_value()) {
+            construct(ValueTag{ }, other.value);
+        } else if (other.has_error()) {
+            construct(ErrorTag{ }, other.error);
+        }
+    }
+
+    constexpr void construct_from(ExpectedStorage &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value
+             && std::is_nothrow_move_constructible<E>::value) {
+        if (other.has_value()) {
+            construct(ValueTag{ }, std::move(other.value));
+        } else if (other.has_error()) {
+            construct(ErrorTag{ }, std::move(other.error));
+        }
+    }
+
+    constexpr void assign_from(const ExpectedStorage &other)
+    noexcept(std::is_nothrow_copy_constructible<T>::value
+             && std::is_nothrow_copy_constructible<E>::value
+             && std::is_nothrow_copy_assignable<T>::value
+             && std::is_nothrow_copy_assignable<E>::value) {
+        if (other.has_value() && has_value()) {
+            this->value = other.value;
+        } else if (other.has_error() && has_error()) {
+            this->error = other.error;
+        } else {
+            reset();
+            construct_from(other);
+        }
+    }
+
+    constexpr void assign_from(ExpectedStorage &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value
+             && std::is_nothrow_move_constructible<E>::value
+             && std::is_nothrow_move_assignable<T>::value
+             && std::is_nothrow_move_assignable<E>::value) {
+        if (other.has_value() && has_value()) {
+            this->value = std::move(other.value);
+        } else if (other.has_error() && has_error()) {
+            this->error = std::move(other.error);
+        } else {
+            reset();
+            construct_from(std::move(other));
+        }
+    }
+
+private:
+    using IsTriviallyReplaceable = all_of<
+        is_trivially_replaceable<T>::value,
+        is_trivially_replaceable<E>::value
+    >;
+
+    template <typename Tag, typename ...Ts>
+    constexpr void construct_impl(std::true_type, Tag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<ExpectedUnion<T, E>, Tag, Ts&&...>::value) {
+        static_cast<ExpectedUnion<T, E>&>(*this) =
+            ExpectedUnion<T, E>{ Tag{ }, std::forward<Ts>(args)... };
+    }
+
+    template <typename ...Ts>
+    void construct_impl(std::false_type, ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+        ::new(static_cast<void*>(std::addressof(this->value)))
+            T(std::forward<Ts>(args)...);
+        this->state = ExpectedState::Value;
+    }
+
+    template <typename ...Ts>
+    void construct_impl(std::false_type, ErrorTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<E, Ts&&...>::value) {
+        ::new(static_cast<void*>(std::addressof(this->error)))
+            E(std::forward<Ts>(args)...);
+        this->state = ExpectedState::Error;
     }
 };
 
+template <typename T, typename E, typename = void>
+struct expected_storage {
+    using type = ExpectedStorage<T, E>;
+};
+
+template <typename T, typename E>
+using ExpectedPayload = SpecialMembers<typename expected_storage<T, E>::type, T, E>;
+
 } // namespace detail
 } // namespace monads
 
@@ -76,7 +76,7 @@ public:
     >
     constexpr explicit Expected(InPlaceValueType, std::initializer_list<U> list, Ts &&...ts)
     noexcept(std::is_nothrow_constructible<T, std::initializer_list<U>&, Ts&&...>::value)
-    : Expected{ InPlaceValueType{ }, list, std::forward<Ts>(ts)... }  { }
+    : storage_(detail::ValueTag{ }, list, std::forward<Ts>(ts)...) { }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<E, Ts&&...>::value, int> = 0>
     constexpr explicit Expected(InPlaceErrorType, Ts &&...ts)
@@ -93,16 +93,15 @@ public:
     >
     constexpr explicit Expected(InPlaceErrorType, std::initializer_list<U> list, Ts &&...ts)
     noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>&, Ts&&...>::value)
-    : Expected{ InPlaceErrorType{ }, list, std::forward<Ts>(ts)... }  { }
+    : storage_(detail::ErrorTag{ }, list, std::forward<Ts>(ts)...) { }
 
-
-    template <std::enable_if_t<
-        std::is_copy_constructible<T>::value && std::is_copy_constructible<E>::value,
-        int
-    > = 0>
-    Expected(const Expected &other) noexcept(
-        std::is_nothrow_copy_constructible<T>::value
-        && std::is_nothrow_copy_constructible<E>::value
+#ifdef MONADS_HAS_CONCEPTS
+    template <typename U, typename F>
+    requires std::is_constructible_v<T, const U&> && std::is_constructible_v<E, const F&>
+    constexpr explicit(!std::is_convertible_v<const U&, T> || !std::is_convertible_v<const F&, E>)
+    Expected(const Expected<U, F> &other) noexcept(
+        std::is_nothrow_constructible<T, const U&>::value
+        && std::is_nothrow_constructible<E, const F&>::value
     ) {
         if (other.has_value()) {
             construct_value(other.unwrap());
@@ -111,13 +110,12 @@ public:
         }
     }
 
-    template <std::enable_if_t<
-        std::is_move_constructible<T>::value && std::is_move_constructible<E>::value,
-        int
-    > = 0>
-    Expected(Expected &&other) noexcept(
-        std::is_nothrow_move_constructible<T>::value
-        && std::is_nothrow_move_constructible<E>::value
+    template <typename U, typename F>
+    requires std::is_constructible_v<T, U&&> && std::is_constructible_v<E, F&&>
+    constexpr explicit(!std::is_convertible_v<U&&, T> || !std::is_convertible_v<F&&, E>)
+    Expected(Expected<U, F> &&other) noexcept(
+        std::is_nothrow_constructible<T, U&&>::value
+        && std::is_nothrow_constructible<E, F&&>::value
     ) {
         if (other.has_value()) {
             construct_value(std::move(other).unwrap());
@@ -126,12 +124,24 @@ public:
         }
     }
 
+    template <typename U>
+    requires std::is_constructible_v<T, U&&> && (!std::is_constructible_v<E, U&&>)
+    constexpr explicit(!std::is_convertible_v<U&&, T>) Expected(U &&u)
+    noexcept(std::is_nothrow_constructible<T, U&&>::value)
+    : storage_{ detail::ValueTag{ }, std::forward<U>(u) } { }
+
+    template <typename F>
+    requires (!std::is_constructible_v<T, F&&>) && std::is_constructible_v<E, F&&>
+    constexpr explicit(!std::is_convertible_v<F&&, E>) Expected(F &&f)
+    noexcept(std::is_nothrow_constructible<E, F&&>::value)
+    : storage_{ detail::ErrorTag{ }, std::forward<F>(f) } { }
+#else
     template <typename U, typename F, std::enable_if_t<
         std::is_constructible<T, const U&>::value && std::is_constructible<E, const F&>::value
         && std::is_convertible<const U&, T>::value && std::is_convertible<const F&, E>::value,
         int
     > = 0>
-    Expected(const Expected<U, F> &other) noexcept(
+    constexpr Expected(const Expected<U, F> &other) noexcept(
         std::is_nothrow_constructible<T, const U&>::value
         && std::is_nothrow_constructible<E, const F&>::value
     ) {
@@ -147,7 +157,7 @@ public:
         && (!std::is_convertible<const U&, T>::value || !std::is_convertible<const F&, E>::value),
         int
     > = 0>
-    explicit Expected(const Expected<U, F> &other) noexcept(
+    constexpr explicit Expected(const Expected<U, F> &other) noexcept(
         std::is_nothrow_constructible<T, const U&>::value
         && std::is_nothrow_constructible<E, const F&>::value
     ) {
@@ -163,7 +173,7 @@ public:
         && std::is_convertible<U&&, T>::value && std::is_convertible<F&&, E>::value,
         int
     > = 0>
-    Expected(Expected<U, F> &&other) noexcept(
+    constexpr Expected(Expected<U, F> &&other) noexcept(
         std::is_nothrow_constructible<T, U&&>::value
         && std::is_nothrow_constructible<E, F&&>::value
     ) {
@@ -175,11 +185,11 @@ public:
     }
 
     template <typename U, typename F, std::enable_if_t<
-        std::is_convertible<T, U&&>::value && std::is_convertible<E, F&&>::value
-        && (!std::is_convertible<U&, T>::value || !std::is_convertible<F&&, E>::value),
+        std::is_constructible<T, U&&>::value && std::is_constructible<E, F&&>::value
+        && (!std::is_convertible<U&&, T>::value || !std::is_convertible<F&&, E>::value),
         int
     > = 0>
-    explicit Expected(Expected<U, F> &&other) noexcept(
+    constexpr explicit Expected(Expected<U, F> &&other) noexcept(
         std::is_nothrow_constructible<T, U&&>::value
         && std::is_nothrow_constructible<E, F&&>::value
     ) {
@@ -211,8 +221,8 @@ public:
         && !std::is_convertible<F&&, T>::value && std::is_convertible<F&&, E>::value,
         int
     > = 0>
-    constexpr Expected(F &&f) noexcept(std::is_nothrow_constructible<T, F&&>::value)
-    : storage_{ detail::ValueTag{ }, std::forward<F>(f) } { }
+    constexpr Expected(F &&f) noexcept(std::is_nothrow_constructible<E, F&&>::value)
+    : storage_{ detail::ErrorTag{ }, std::forward<F>(f) } { }
 
     template <typename F, std::enable_if_t<
         !std::is_constructible<T, F&&>::value && std::is_constructible<E, F&&>::value
@@ -221,65 +231,14 @@ public:
     > = 0>
     constexpr explicit Expected(F &&f) noexcept(std::is_nothrow_constructible<E, F&&>::value)
     : storage_{ detail::ErrorTag{ }, std::forward<F>(f) } { }
-
-    template <std::enable_if_t<
-        std::is_copy_constructible<T>::value && std::is_copy_constructible<E>::value
-        && std::is_copy_assignable<T>::value && std::is_copy_assignable<E>::value,
-        int
-    > = 0>
-    Expected& operator=(const Expected &other) noexcept(
-        std::is_nothrow_copy_constructible<T>::value
-        && std::is_nothrow_copy_constructible<E>::value
-        && std::is_nothrow_copy_assignable<T>::value
-        && std::is_nothrow_copy_assignable<E>::value
-    ) {
-        if (other.has_value()) {
-            if (has_value()) {
-                unwrap() = other.unwrap();
-            } else if (other.has_error()) {
-                emplace(other.unwrap());
-            }
-        } else if (other.has_error()) {
-            if (has_error()) {
-                unwrap_error() = other.unwrap_error();
-            } else if (other.has_value()) {
-                emplace_error(other.unwrap_error());
-            }
-        }
-    }
-
-    template <std::enable_if_t<
-        std::is_move_constructible<T>::value && std::is_move_constructible<E>::value
-        && std::is_move_assignable<T>::value && std::is_move_assignable<E>::value,
-        int
-    > = 0>
-    Expected& operator=(Expected &&other) noexcept(
-        std::is_nothrow_move_constructible<T>::value
-        && std::is_nothrow_move_constructible<E>::value
-        && std::is_nothrow_move_assignable<E>::value
-        && std::is_nothrow_move_assignable<T>::value
-    ) {
-        if (other.has_value()) {
-            if (has_value()) {
-                unwrap() = std::move(other).unwrap();
-            } else {
-                emplace(std::move(other).unwrap());
-            }
-        } else if (other.has_error()) {
-            if (has_error()) {
-                unwrap_error() = std::move(other).unwrap();
-            } else {
-                emplace_error(std::move(other).unwrap_error());
-            }
-        }
-    }
+#endif
 
     constexpr bool has_value() const noexcept {
-        return storage_.state == detail::ExpectedState::Value;
+        return storage_.has_value();
     }
 
     constexpr bool has_error() const noexcept {
-        return storage_.state == detail::ExpectedState::Error;
+        return storage_.has_error();
     }
 
     constexpr explicit operator bool() const noexcept {
@@ -299,11 +258,11 @@ public:
     }
 
     constexpr T&& operator*() && {
-        return unwrap();
+        return std::move(*this).unwrap();
     }
 
     constexpr const T&& operator*() const && {
-        return unwrap();
+        return std::move(*this).unwrap();
     }
 
     constexpr T* operator->() {
@@ -335,7 +294,7 @@ public:
             throw BadExpectedAccess{ };
         }
 
-        return unwrap();
+        return std::move(*this).unwrap();
     }
 
     constexpr const T&& value() const && {
@@ -343,7 +302,7 @@ public:
             throw BadExpectedAccess{ };
         }
 
-        return unwrap();
+        return std::move(*this).unwrap();
     }
 
     constexpr E& error() & {
@@ -351,7 +310,7 @@ public:
             throw BadExpectedAccess{ };
         }
 
-        return storage_.error;
+        return unwrap_error();
     }
 
     constexpr const E& error() const & {
@@ -367,7 +326,7 @@ public:
             throw BadExpectedAccess{ };
         }
 
-        return unwrap_error();
+        return std::move(*this).unwrap_error();
     }
 
     constexpr const E&& error() const && {
@@ -375,43 +334,43 @@ public:
             throw BadExpectedAccess{ };
         }
 
-        return unwrap_error();
+        return std::move(*this).unwrap_error();
     }
 
     constexpr T& unwrap() & {
-        return storage_.value;
+        return storage_.get(detail::ValueTag{ });
     }
 
     constexpr const T& unwrap() const & {
-        return storage_.value;
+        return storage_.get(detail::ValueTag{ });
     }
 
     constexpr T&& unwrap() && {
-        return std::move(storage_.value);
+        return std::move(storage_.get(detail::ValueTag{ }));
     }
 
     constexpr const T&& unwrap() const && {
-        return std::move(storage_.value);
+        return std::move(storage_.get(detail::ValueTag{ }));
     }
 
     constexpr E& unwrap_error() & {
-        return storage_.error;
+        return storage_.get(detail::ErrorTag{ });
     }
 
     constexpr const E& unwrap_error() const & {
-        return storage_.error;
+        return storage_.get(detail::ErrorTag{ });
     }
 
     constexpr E&& unwrap_error() && {
-        return std::move(storage_.error);
+        return std::move(storage_.get(detail::ErrorTag{ }));
     }
 
     constexpr const E&& unwrap_error() const && {
-        return std::move(storage_.error);
+        return std::move(storage_.get(detail::ErrorTag{ }));
     }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0>
-    T& emplace(Ts &&...ts) noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+    constexpr T& emplace(Ts &&...ts) noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
         storage_.reset();
 
         return construct_value(std::forward<Ts>(ts)...);
@@ -425,13 +384,15 @@ public:
             int
         > = 0
     >
-    T& emplace(std::initializer_list<U> list, Ts &&...ts)
+    constexpr T& emplace(std::initializer_list<U> list, Ts &&...ts)
     noexcept(std::is_nothrow_constructible<T, std::initializer_list<U>&, Ts&&...>::value) {
-        return emplace(list, std::forward<Ts>(ts)...);
+        storage_.reset();
+
+        return construct_value(list, std::forward<Ts>(ts)...);
     }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<E, Ts&&...>::value, int> = 0>
-    E& emplace_error(Ts &&...ts) noexcept(std::is_nothrow_constructible<E, Ts&&...>::value) {
+    constexpr E& emplace_error(Ts &&...ts) noexcept(std::is_nothrow_constructible<E, Ts&&...>::value) {
         storage_.reset();
 
         return construct_error(std::forward<Ts>(ts)...);
@@ -445,11 +406,17 @@ public:
             int
         > = 0
     >
-    E& emplace_error(std::initializer_list<U> list, Ts &&...ts)
+    constexpr E& emplace_error(std::initializer_list<U> list, Ts &&...ts)
     noexcept(std::is_nothrow_constructible<E, std::initializer_list<U>&, Ts&&...>::value) {
-        return emplace_error(list, std::forward<Ts>(ts)...);
+        storage_.reset();
+
+        return construct_error(list, std::forward<Ts>(ts)...);
     }
 
+#ifdef MONADS_HAS_CONCEPTS
+    template <typename C>
+    requires detail::invocable<C&&, const T&> && std::is_copy_constructible_v<E>
+#else
     template <
         typename C,
         std::enable_if_t<
@@ -458,6 +425,7 @@ public:
             int
         > = 0
     >
+#endif
     constexpr Expected<detail::invoke_result_t<C&&, const T&>, E> map(C &&callable) const &
     noexcept(
         detail::is_nothrow_invocable<C&&, const T&>::value
@@ -479,6 +447,10 @@ public:
         };
     }
 
+#ifdef MONADS_HAS_CONCEPTS
+    template <typename C>
+    requires detail::invocable<C&&, T&&> && std::is_move_constructible_v<E>
+#else
     template <
         typename C,
         std::enable_if_t<
@@ -487,6 +459,7 @@ public:
             int
         > = 0
     >
+#endif
     constexpr Expected<detail::invoke_result_t<C&&, T&&>, E> map(C &&callable) && noexcept(
         detail::is_nothrow_invocable<C&&, T&&>::value
         && std::is_nothrow_move_constructible<E>::value
@@ -511,6 +484,10 @@ public:
         };
     }
 
+#ifdef MONADS_HAS_CONCEPTS
+    template <typename C>
+    requires detail::invocable<C&&, const E&> && std::is_copy_constructible_v<T>
+#else
     template <
         typename C,
         std::enable_if_t<
@@ -519,6 +496,7 @@ public:
             int
         > = 0
     >
+#endif
     constexpr Expected<T, detail::invoke_result_t<C&&, const E&>> map_error(C &&callable) const &
     noexcept(
         detail::is_nothrow_invocable<C&&, const E&>::value
@@ -541,6 +519,10 @@ public:
         };
     }
 
+#ifdef MONADS_HAS_CONCEPTS
+    template <typename C>
+    requires detail::invocable<C&&, E&&> && std::is_move_constructible_v<T>
+#else
     template <
         typename C,
         std::enable_if_t<
@@ -549,6 +531,7 @@ public:
             int
         > = 0
     >
+#endif
     constexpr Expected<T, detail::invoke_result_t<C&&, E&&>> map_error(C &&callable) && noexcept(
         detail::is_nothrow_invocable<C&&, E&&>::value
         && std::is_nothrow_move_constructible<T>::value
@@ -577,35 +560,18 @@ private:
     constexpr explicit Expected(detail::Monostate) noexcept { }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0>
-    T& construct_value(Ts &&...args) noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
-        try {
-            ::new(std::addressof(storage_.value)) T(std::forward<Ts>(args)...);
-            storage_.state = detail::ExpectedState::Value;
-
-            return storage_.value;
-        } catch (...) {
-            storage_.state = detail::ExpectedState::Monostate;
-
-            throw;
-        }
+    constexpr T& construct_value(Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+        return storage_.construct(detail::ValueTag{ }, std::forward<Ts>(args)...);
     }
 
     template <typename ...Ts, std::enable_if_t<std::is_constructible<E, Ts&&...>::value, int> = 0>
-    E& construct_error(Ts &&...args) noexcept(std::is_nothrow_constructible<E, Ts&&...>::value) {
-        try {
-            ::new(std::addressof(storage_.value)) E(std::forward<Ts>(args)...);
-            storage_.state = detail::ExpectedState::Error;
-
-            return storage_.error;
-        } catch (...) {
-            storage_.state = detail::ExpectedState::Monostate;
-
-            throw;
-        }
+    constexpr E& construct_error(Ts &&...args)
+    noexcept(std::is_nothrow_constructible<E, Ts&&...>::value) {
+        return storage_.construct(detail::ErrorTag{ }, std::forward<Ts>(args)...);
     }
 
-
-    detail::ExpectedStorage<T, E> storage_;
+    detail::ExpectedPayload<T, E> storage_;
 };
 
 } // namespace monads
@@ -0,0 +1,325 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_INSTRUMENTATION_HPP
+#define MONADS_DETAIL_INSTRUMENTATION_HPP
+
+#ifdef MONADS_INSTRUMENTATION
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <ostream>
+#include <typeinfo>
+#include <vector>
+#endif
+
+namespace monads {
+
+#ifdef MONADS_INSTRUMENTATION
+struct ErrorSite {
+    const char *file = nullptr;
+    int line = 0;
+    const char *function = nullptr;
+
+    static constexpr ErrorSite current(
+        const char *file = __builtin_FILE(),
+        int line = __builtin_LINE(),
+        const char *function = __builtin_FUNCTION()
+    ) noexcept {
+        return ErrorSite{ file, line, function };
+    }
+};
+
+struct ErrorEvent {
+    ErrorSite site;
+    const std::type_info *error_type;
+    std::uint64_t timestamp_ns;
+};
+
+struct ErrorCount {
+    ErrorSite site;
+    const std::type_info *error_type;
+    std::uint64_t count;
+    std::uint64_t last_timestamp_ns;
+};
+
+namespace detail {
+
+constexpr std::size_t COUNTER_TABLE_SIZE = 256;
+
+struct CounterEntry {
+    std::atomic<bool> occupied{ false };
+    ErrorSite site;
+    const std::type_info *error_type = nullptr;
+    std::atomic<std::uint64_t> count{ 0 };
+    std::atomic<std::uint64_t> last_timestamp_ns{ 0 };
+};
+
+inline bool same_site(const ErrorSite &lhs, const ErrorSite &rhs) noexcept {
+    return lhs.line == rhs.line
+           && (lhs.file == rhs.file
+               || (lhs.file && rhs.file && std::strcmp(lhs.file, rhs.file) == 0))
+           && (lhs.function == rhs.function
+               || (lhs.function && rhs.function
+                   && std::strcmp(lhs.function, rhs.function) == 0));
+}
+
+class CounterTable {
+public:
+    void record(const ErrorEvent &event) noexcept {
+        const std::size_t first = hash(event) % COUNTER_TABLE_SIZE;
+
+        for (std::size_t i = 0; i < COUNTER_TABLE_SIZE; ++i) {
+            CounterEntry &entry = entries_[(first + i) % COUNTER_TABLE_SIZE];
+
+            if (!entry.occupied.load(std::memory_order_relaxed)) {
+                entry.site = event.site;
+                entry.error_type = event.error_type;
+                entry.occupied.store(true, std::memory_order_release);
+            } else if (entry.site.file != event.site.file
+                       || entry.site.line != event.site.line
+                       || entry.site.function != event.site.function
+                       || entry.error_type != event.error_type) {
+                continue;
+            }
+
+            entry.count.fetch_add(1, std::memory_order_relaxed);
+            entry.last_timestamp_ns.store(event.timestamp_ns, std::memory_order_relaxed);
+
+            return;
+        }
+
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void collect(std::vector<ErrorCount> &counts) const {
+        for (const CounterEntry &entry : entries_) {
+            if (!entry.occupied.load(std::memory_order_acquire)) {
+                continue;
+            }
+
+            const ErrorCount each{
+                entry.site,
+                entry.error_type,
+                entry.count.load(std::memory_order_relaxed),
+                entry.last_timestamp_ns.load(std::memory_order_relaxed)
+            };
+
+            merge(counts, each);
+        }
+    }
+
+    std::uint64_t dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    bool try_claim() noexcept {
+        bool expected = false;
+
+        return in_use_.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+    }
+
+    void release() noexcept {
+        in_use_.store(false, std::memory_order_release);
+    }
+
+    CounterTable *next = nullptr;
+
+private:
+    static std::size_t hash(const ErrorEvent &event) noexcept {
+        const auto file = reinterpret_cast<std::uintptr_t>(event.site.file);
+        const auto type = reinterpret_cast<std::uintptr_t>(event.error_type);
+        const auto line = static_cast<std::uintptr_t>(event.site.line);
+
+        return static_cast<std::size_t>(
+            (file ^ (type >> 4) ^ (line * 0x9e3779b97f4a7c15u)) * 0xff51afd7ed558ccdu
+            >> 32
+        );
+    }
+
+    static void merge(std::vector<ErrorCount> &counts, const ErrorCount &each) {
+        for (ErrorCount &existing : counts) {
+            if (*existing.error_type == *each.error_type
+                && same_site(existing.site, each.site)) {
+                existing.count += each.count;
+
+                if (each.last_timestamp_ns > existing.last_timestamp_ns) {
+                    existing.last_timestamp_ns = each.last_timestamp_ns;
+                }
+
+                return;
+            }
+        }
+
+        counts.push_back(each);
+    }
+
+    std::atomic<bool> in_use_{ true };
+    std::atomic<std::uint64_t> dropped_{ 0 };
+    CounterEntry entries_[COUNTER_TABLE_SIZE];
+};
+
+inline std::atomic<CounterTable*>& counter_tables() noexcept {
+    static std::atomic<CounterTable*> head{ nullptr };
+
+    return head;
+}
+
+inline CounterTable* acquire_counter_table() noexcept {
+    std::atomic<CounterTable*> &head = counter_tables();
+
+    for (CounterTable *table = head.load(std::memory_order_acquire); table;
+         table = table->next) {
+        if (table->try_claim()) {
+            return table;
+        }
+    }
+
+    CounterTable *const table = new(std::nothrow) CounterTable;
+
+    if (!table) {
+        return nullptr;
+    }
+
+    table->next = head.load(std::memory_order_relaxed);
+
+    while (!head.compare_exchange_weak(table->next, table, std::memory_order_release,
+                                       std::memory_order_relaxed)) { }
+
+    return table;
+}
+
+struct CounterTableLease {
+    CounterTableLease() noexcept : table{ acquire_counter_table() } { }
+
+    CounterTableLease(const CounterTableLease &other) = delete;
+
+    ~CounterTableLease() {
+        if (table) {
+            table->release();
+        }
+    }
+
+    CounterTableLease& operator=(const CounterTableLease &other) = delete;
+
+    CounterTable *table;
+};
+
+inline CounterTable* local_counter_table() noexcept {
+    thread_local CounterTableLease lease;
+
+    return lease.table;
+}
+
+} // namespace detail
+
+class CounterSink {
+public:
+    static void record(const ErrorEvent &event) noexcept {
+        detail::CounterTable *const table = detail::local_counter_table();
+
+        if (table) {
+            table->record(event);
+        }
+    }
+
+    static std::vector<ErrorCount> snapshot() {
+        std::vector<ErrorCount> counts;
+
+        for (const detail::CounterTable *table = detail::counter_tables().load(std::memory_order_acquire);
+             table; table = table->next) {
+            table->collect(counts);
+        }
+
+        return counts;
+    }
+
+    static std::uint64_t dropped() noexcept {
+        std::uint64_t total = 0;
+
+        for (const detail::CounterTable *table = detail::counter_tables().load(std::memory_order_acquire);
+             table; table = table->next) {
+            total += table->dropped();
+        }
+
+        return total;
+    }
+
+    static void dump(std::ostream &os) {
+        for (const ErrorCount &each : snapshot()) {
+            os << (each.site.file ? each.site.file : "<unknown>") << ':' << each.site.line
+               << ": " << (each.site.function ? each.site.function : "<unknown>")
+               << ": " << each.error_type->name() << ": " << each.count << '\n';
+        }
+    }
+};
+
+#ifndef MONADS_INSTRUMENTATION_SINK
+#define MONADS_INSTRUMENTATION_SINK ::monads::CounterSink
+#endif
+#else
+struct ErrorSite {
+    static constexpr ErrorSite current() noexcept {
+        return ErrorSite{ };
+    }
+};
+#endif
+
+namespace detail {
+
+// a defaulted call site cannot follow an argument pack, so the plain entry
+// points are overloaded for up to this many arguments to capture it
+constexpr int MAX_SITED_ARGUMENTS = 3;
+
+template <typename E>
+inline void record_error(const ErrorSite &site) noexcept {
+#ifdef MONADS_INSTRUMENTATION
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+    MONADS_INSTRUMENTATION_SINK::record(ErrorEvent{
+        site,
+        &typeid(E),
+        static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()
+        )
+    });
+#else
+    static_cast<void>(site);
+#endif
+}
+
+} // namespace detail
+} // namespace monads
+
+#endif
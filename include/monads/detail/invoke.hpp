@@ -33,16 +33,74 @@
 #define MONADS_DETAIL_INVOKE_HPP
 
 #include <monads/detail/common.hpp>
-#include <monads/detail/invoke_detail.hpp>
 
 #include <functional>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#if !defined(MONADS_NO_STD_INVOKE) && defined(__cpp_lib_is_invocable) \
+    && defined(__cpp_if_constexpr)
+#define MONADS_HAS_STD_INVOKE_TRAITS
+#else
+#include <monads/detail/invoke_detail.hpp>
+#endif
+
 namespace monads {
 namespace detail {
 
+#ifdef MONADS_HAS_STD_INVOKE_TRAITS
+template <typename T, typename ...As>
+struct invoke_result : std::invoke_result<T, As...> { };
+
+template <typename T, typename ...As>
+using invoke_result_t = typename invoke_result<T, As...>::type;
+
+template <typename T, typename ...As>
+struct is_invocable : std::is_invocable<T, As...> { };
+
+template <typename T, typename ...As>
+struct is_nothrow_invocable : std::is_nothrow_invocable<T, As...> { };
+
+template <typename T>
+struct is_reference_wrapper : std::false_type { };
+
+template <typename T>
+struct is_reference_wrapper<std::reference_wrapper<T>> : std::true_type { };
+
+template <typename M, typename T, typename A, typename ...As>
+constexpr decltype(auto) invoke_member(M T::*member, A &&object, As &&...args) {
+    using Object = std::decay_t<A>;
+
+    if constexpr (std::is_function<M>::value) {
+        if constexpr (std::is_base_of<T, Object>::value) {
+            return (std::forward<A>(object).*member)(std::forward<As>(args)...);
+        } else if constexpr (is_reference_wrapper<Object>::value) {
+            return (object.get().*member)(std::forward<As>(args)...);
+        } else {
+            return ((*std::forward<A>(object)).*member)(std::forward<As>(args)...);
+        }
+    } else {
+        if constexpr (std::is_base_of<T, Object>::value) {
+            return std::forward<A>(object).*member;
+        } else if constexpr (is_reference_wrapper<Object>::value) {
+            return object.get().*member;
+        } else {
+            return (*std::forward<A>(object)).*member;
+        }
+    }
+}
+
+template <typename C, typename ...As, std::enable_if_t<is_invocable<C&&, As&&...>::value, int> = 0>
+constexpr invoke_result_t<C&&, As&&...> invoke(C &&c, As &&...args)
+noexcept(is_nothrow_invocable<C&&, As&&...>::value) {
+    if constexpr (std::is_member_pointer<std::decay_t<C>>::value) {
+        return invoke_member(c, std::forward<As>(args)...);
+    } else {
+        return std::forward<C>(c)(std::forward<As>(args)...);
+    }
+}
+#else
 template <typename T, typename ...As>
 struct invoke_result : monads_detail_invoke_detail::invoke_result<T, void, As...> { };
 
@@ -64,6 +122,12 @@ noexcept(is_nothrow_invocable<C&&, As&&...>::value) {
         std::forward<As>(args)...
     );
 }
+#endif
+
+#ifdef MONADS_HAS_CONCEPTS
+template <typename C, typename ...As>
+concept invocable = is_invocable<C, As...>::value;
+#endif
 
 } // namespace detail
 } // namespace monads
@@ -0,0 +1,191 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_LATENCY_HPP
+#define MONADS_DETAIL_LATENCY_HPP
+
+#include <monads/detail/circuit_breaker.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MONADS_HAS_TSC_CLOCK
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace monads {
+namespace detail {
+
+constexpr std::size_t LATENCY_SUB_BUCKET_BITS = 4;
+
+constexpr std::size_t LATENCY_SUB_BUCKETS = std::size_t{ 1 } << LATENCY_SUB_BUCKET_BITS;
+
+constexpr std::size_t LATENCY_MAX_EXPONENT = 40;
+
+constexpr std::size_t LATENCY_BUCKETS =
+    (LATENCY_MAX_EXPONENT - LATENCY_SUB_BUCKET_BITS + 2) * LATENCY_SUB_BUCKETS;
+
+inline std::size_t highest_bit(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(63 - __builtin_clzll(value | 1));
+#else
+    std::size_t bit = 0;
+
+    while (value >>= 1) {
+        ++bit;
+    }
+
+    return bit;
+#endif
+}
+
+inline std::size_t latency_bucket(std::uint64_t nanoseconds) noexcept {
+    if (nanoseconds < LATENCY_SUB_BUCKETS) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+
+    const std::size_t bit = highest_bit(nanoseconds);
+
+    if (bit > LATENCY_MAX_EXPONENT) {
+        return LATENCY_BUCKETS - 1;
+    }
+
+    const std::size_t shift = bit - LATENCY_SUB_BUCKET_BITS;
+    const std::size_t sub_bucket =
+        static_cast<std::size_t>(nanoseconds >> shift) & (LATENCY_SUB_BUCKETS - 1);
+
+    return (shift + 1) * LATENCY_SUB_BUCKETS + sub_bucket;
+}
+
+inline std::uint64_t latency_bucket_floor(std::size_t bucket) noexcept {
+    if (bucket < LATENCY_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    const std::size_t shift = bucket / LATENCY_SUB_BUCKETS - 1;
+    const std::uint64_t sub_bucket = bucket % LATENCY_SUB_BUCKETS;
+
+    return (LATENCY_SUB_BUCKETS + sub_bucket) << shift;
+}
+
+#ifdef MONADS_HAS_TSC_CLOCK
+struct TscCalibration {
+    std::uint64_t base;
+    double nanoseconds_per_tick;
+};
+
+inline std::uint64_t read_tsc() noexcept {
+    return static_cast<std::uint64_t>(__rdtsc());
+}
+
+// measures the tick rate against steady_clock over one millisecond
+inline TscCalibration calibrate_tsc() noexcept {
+    using std::chrono::steady_clock;
+
+    const steady_clock::time_point start = steady_clock::now();
+    const std::uint64_t first = read_tsc();
+    steady_clock::time_point end;
+    std::uint64_t last;
+
+    do {
+        end = steady_clock::now();
+        last = read_tsc();
+    } while (end - start < std::chrono::milliseconds{ 1 });
+
+    const double elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+
+    return TscCalibration{
+        first,
+        last > first ? elapsed / static_cast<double>(last - first) : 1.0
+    };
+}
+
+inline const TscCalibration& tsc_calibration() noexcept {
+    static const TscCalibration calibration = calibrate_tsc();
+
+    return calibration;
+}
+#endif
+
+struct alignas(CACHE_LINE_SIZE) LatencyShard {
+    std::atomic<std::uint64_t> successes[LATENCY_BUCKETS];
+    std::atomic<std::uint64_t> failures[LATENCY_BUCKETS];
+};
+
+// each thread takes the next shard the first time it records, so threads only
+// share a shard when there are more of them than shards
+inline std::size_t thread_shard_index() noexcept {
+    static std::atomic<std::size_t> next{ 0 };
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+
+    return index;
+}
+
+class ShardedLatencyCounts {
+public:
+    explicit ShardedLatencyCounts(std::size_t shards)
+    : shards_(shards == 0 ? 1 : shards) { }
+
+    void record(bool success, std::uint64_t nanoseconds) noexcept {
+        LatencyShard &shard = shards_[thread_shard_index() % shards_.size()];
+        std::atomic<std::uint64_t> *const counts =
+            success ? shard.successes : shard.failures;
+
+        counts[latency_bucket(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template <typename F>
+    void for_each(F &&f) const {
+        for (const LatencyShard &shard : shards_) {
+            for (std::size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+                f(true, i, shard.successes[i].load(std::memory_order_relaxed));
+                f(false, i, shard.failures[i].load(std::memory_order_relaxed));
+            }
+        }
+    }
+
+private:
+    std::vector<LatencyShard, AlignedAllocator<LatencyShard>> shards_;
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
@@ -0,0 +1,160 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_LAZY_HPP
+#define MONADS_DETAIL_LAZY_HPP
+
+#include <atomic>
+#include <utility>
+
+#ifndef __cpp_lib_atomic_wait
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#endif
+
+namespace monads {
+namespace detail {
+
+#ifndef __cpp_lib_atomic_wait
+constexpr std::size_t ONCE_PARKING_SIZE = 16;
+
+struct OnceParking {
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+// shared by every OnceFlag so that a flag stays one byte; waiters on flags
+// hashed to the same slot are woken together and check their own state again
+inline OnceParking& once_parking(const void *flag) noexcept {
+    static OnceParking parking[ONCE_PARKING_SIZE];
+
+    return parking[(reinterpret_cast<std::uintptr_t>(flag) >> 4) % ONCE_PARKING_SIZE];
+}
+#endif
+
+class OnceFlag {
+public:
+    constexpr OnceFlag() noexcept = default;
+
+    OnceFlag(const OnceFlag &other) = delete;
+
+    OnceFlag& operator=(const OnceFlag &other) = delete;
+
+    bool is_ready() const noexcept {
+        return state_.load(std::memory_order_acquire) == READY;
+    }
+
+    template <typename C>
+    void call_once(C &&callable) {
+        if (is_ready()) {
+            return;
+        }
+
+        call_once_slow(std::forward<C>(callable));
+    }
+
+private:
+    static constexpr unsigned char EMPTY = 0;
+    static constexpr unsigned char RUNNING = 1;
+    static constexpr unsigned char READY = 2;
+    // RUNNING with at least one thread parked in once_parking
+    static constexpr unsigned char WAITING = 3;
+
+    template <typename C>
+    void call_once_slow(C &&callable) {
+        while (true) {
+            unsigned char state = EMPTY;
+
+            if (state_.compare_exchange_strong(state, RUNNING,
+                                               std::memory_order_acquire)) {
+                try {
+                    std::forward<C>(callable)();
+                } catch (...) {
+                    publish(EMPTY);
+
+                    throw;
+                }
+
+                publish(READY);
+
+                return;
+            } else if (state == READY) {
+                return;
+            }
+
+            wait_while_running();
+        }
+    }
+
+#ifdef __cpp_lib_atomic_wait
+    void publish(unsigned char state) noexcept {
+        state_.store(state, std::memory_order_release);
+        state_.notify_all();
+    }
+
+    void wait_while_running() noexcept {
+        state_.wait(RUNNING, std::memory_order_acquire);
+    }
+#else
+    void publish(unsigned char state) {
+        if (state_.exchange(state, std::memory_order_acq_rel) != WAITING) {
+            return;
+        }
+
+        // a waiter holds the mutex from marking the flag until it is parked
+        OnceParking &parking = once_parking(this);
+        { const std::lock_guard<std::mutex> guard{ parking.mutex }; }
+        parking.condition.notify_all();
+    }
+
+    void wait_while_running() {
+        OnceParking &parking = once_parking(this);
+        std::unique_lock<std::mutex> lock{ parking.mutex };
+        unsigned char state = RUNNING;
+
+        if (state_.compare_exchange_strong(state, WAITING, std::memory_order_acquire)
+            || state == WAITING) {
+            parking.condition.wait(lock, [this] {
+                return state_.load(std::memory_order_acquire) != WAITING;
+            });
+        }
+    }
+#endif
+
+    std::atomic<unsigned char> state_{ EMPTY };
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
@@ -0,0 +1,134 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_MEMOIZE_HPP
+#define MONADS_DETAIL_MEMOIZE_HPP
+
+#include <monads/detail/common.hpp>
+#include <monads/detail/invoke.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+namespace detail {
+
+template <typename R, typename ...As>
+struct signature_traits {
+    using result = R;
+    using key = std::tuple<std::decay_t<As>...>;
+};
+
+template <typename C, typename = void>
+struct callable_traits { };
+
+template <typename R, typename ...As>
+struct callable_traits<R(*)(As...)> : signature_traits<R, As...> { };
+
+template <typename R, typename C, typename ...As>
+struct callable_traits<R(C::*)(As...)> : signature_traits<R, As...> { };
+
+template <typename R, typename C, typename ...As>
+struct callable_traits<R(C::*)(As...) const> : signature_traits<R, As...> { };
+
+#ifdef __cpp_noexcept_function_type
+template <typename R, typename ...As>
+struct callable_traits<R(*)(As...) noexcept> : signature_traits<R, As...> { };
+
+template <typename R, typename C, typename ...As>
+struct callable_traits<R(C::*)(As...) noexcept> : signature_traits<R, As...> { };
+
+template <typename R, typename C, typename ...As>
+struct callable_traits<R(C::*)(As...) const noexcept>
+: signature_traits<R, As...> { };
+#endif
+
+template <typename C>
+struct callable_traits<C, void_t<decltype(&C::operator())>>
+: callable_traits<decltype(&C::operator())> { };
+
+template <typename C, typename K>
+struct memoized_result;
+
+template <typename C, typename ...Ts>
+struct memoized_result<C, std::tuple<Ts...>>
+: invoke_result<const C&, const Ts&...> { };
+
+inline std::size_t hash_combine(std::size_t seed, std::size_t hash) noexcept {
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+template <typename T>
+struct TupleHash;
+
+template <typename ...Ts>
+struct TupleHash<std::tuple<Ts...>> {
+    std::size_t operator()(const std::tuple<Ts...> &tuple) const {
+        return hash(tuple, std::index_sequence_for<Ts...>{ });
+    }
+
+private:
+    template <std::size_t ...Is>
+    static std::size_t hash(const std::tuple<Ts...> &tuple,
+                            std::index_sequence<Is...>) {
+        std::size_t seed = 0;
+        const std::size_t hashes[] = {
+            std::hash<Ts>{ }(std::get<Is>(tuple))...,
+            0
+        };
+
+        for (const std::size_t element : hashes) {
+            seed = hash_combine(seed, element);
+        }
+
+        return seed;
+    }
+};
+
+template <typename C, typename ...Ts, std::size_t ...Is>
+constexpr decltype(auto) apply(C &&callable, const std::tuple<Ts...> &tuple,
+                               std::index_sequence<Is...>) {
+    return std::forward<C>(callable)(std::get<Is>(tuple)...);
+}
+
+template <typename C, typename ...Ts>
+constexpr decltype(auto) apply(C &&callable, const std::tuple<Ts...> &tuple) {
+    return apply(std::forward<C>(callable), tuple,
+                 std::index_sequence_for<Ts...>{ });
+}
+
+} // namespace detail
+} // namespace monads
+
+#endif
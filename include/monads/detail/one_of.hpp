@@ -0,0 +1,584 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_ONE_OF_HPP
+#define MONADS_DETAIL_ONE_OF_HPP
+
+#include <monads/detail/common.hpp>
+#include <monads/detail/expected.hpp>
+#include <monads/detail/special_members.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+template <typename ...Es>
+class OneOf;
+
+namespace detail {
+
+// a OneOf and every arm of a merged Expected<T, OneOf<Es...>> start with the
+// same byte: empty, value, then one tag per alternative
+constexpr std::uint8_t ONE_OF_EMPTY_TAG = 0;
+constexpr std::uint8_t ONE_OF_VALUE_TAG = 1;
+constexpr std::uint8_t ONE_OF_FIRST_ERROR_TAG = 2;
+
+constexpr std::size_t ONE_OF_MAX_ALTERNATIVES = 256 - ONE_OF_FIRST_ERROR_TAG;
+
+template <std::size_t I>
+using IndexConstant = std::integral_constant<std::size_t, I>;
+
+// sizeof...(Es) if E is not an alternative
+template <typename E, typename ...Es>
+struct one_of_index : IndexConstant<0> { };
+
+template <typename E, typename F, typename ...Es>
+struct one_of_index<E, F, Es...> : IndexConstant<
+    std::is_same<E, F>::value ? 0 : 1 + one_of_index<E, Es...>::value
+> { };
+
+template <typename E, typename ...Es>
+struct one_of_count : IndexConstant<0> { };
+
+template <typename E, typename F, typename ...Es>
+struct one_of_count<E, F, Es...> : IndexConstant<
+    (std::is_same<E, F>::value ? 1 : 0) + one_of_count<E, Es...>::value
+> { };
+
+template <typename E, typename ...Es>
+struct is_one_of_alternative : std::integral_constant<
+    bool,
+    (one_of_index<E, Es...>::value < sizeof...(Es))
+> { };
+
+template <std::size_t I, typename ...Es>
+using one_of_alternative_t = std::tuple_element_t<I, std::tuple<Es...>>;
+
+template <bool Trivial, typename ...Es>
+union OneOfUnion;
+
+template <bool Trivial>
+union OneOfUnion<Trivial> {
+    Monostate monostate;
+
+    constexpr OneOfUnion() noexcept : monostate{ } { }
+};
+
+template <typename E, typename ...Es>
+union OneOfUnion<true, E, Es...> {
+    E head;
+    OneOfUnion<true, Es...> tail;
+
+    constexpr OneOfUnion() noexcept : tail{ } { }
+
+    template <typename ...Ts>
+    constexpr OneOfUnion(IndexConstant<0>, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<E, Ts&&...>::value)
+    : head(std::forward<Ts>(args)...) { }
+
+    template <std::size_t I, typename ...Ts, std::enable_if_t<(I > 0), int> = 0>
+    constexpr OneOfUnion(IndexConstant<I>, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<
+        OneOfUnion<true, Es...>,
+        IndexConstant<I - 1>,
+        Ts&&...
+    >::value)
+    : tail{ IndexConstant<I - 1>{ }, std::forward<Ts>(args)... } { }
+};
+
+template <typename E, typename ...Es>
+union OneOfUnion<false, E, Es...> {
+    E head;
+    OneOfUnion<false, Es...> tail;
+
+    constexpr OneOfUnion() noexcept : tail{ } { }
+
+    template <typename ...Ts>
+    constexpr OneOfUnion(IndexConstant<0>, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<E, Ts&&...>::value)
+    : head(std::forward<Ts>(args)...) { }
+
+    template <std::size_t I, typename ...Ts, std::enable_if_t<(I > 0), int> = 0>
+    constexpr OneOfUnion(IndexConstant<I>, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<
+        OneOfUnion<false, Es...>,
+        IndexConstant<I - 1>,
+        Ts&&...
+    >::value)
+    : tail{ IndexConstant<I - 1>{ }, std::forward<Ts>(args)... } { }
+
+    MONADS_CONSTEXPR20 ~OneOfUnion() { }
+};
+
+template <typename U>
+constexpr auto& one_of_get(U &alternatives, IndexConstant<0>) noexcept {
+    return alternatives.head;
+}
+
+template <typename U, std::size_t I, std::enable_if_t<(I > 0), int> = 0>
+constexpr auto& one_of_get(U &alternatives, IndexConstant<I>) noexcept {
+    return one_of_get(alternatives.tail, IndexConstant<I - 1>{ });
+}
+
+// calls f with IndexConstant<index>; compilers lower the chain to a jump table
+template <
+    typename R,
+    std::size_t I,
+    std::size_t N,
+    typename F,
+    std::enable_if_t<(I + 1 == N), int> = 0
+>
+constexpr R one_of_dispatch(std::size_t, F &&f) {
+    return std::forward<F>(f)(IndexConstant<I>{ });
+}
+
+template <
+    typename R,
+    std::size_t I,
+    std::size_t N,
+    typename F,
+    std::enable_if_t<(I + 1 < N), int> = 0
+>
+constexpr R one_of_dispatch(std::size_t index, F &&f) {
+    if (index == I) {
+        return std::forward<F>(f)(IndexConstant<I>{ });
+    }
+
+    return one_of_dispatch<R, I + 1, N>(index, std::forward<F>(f));
+}
+
+// the tag is written only once the alternative has been constructed, so a
+// throwing constructor leaves ONE_OF_EMPTY_TAG behind in a merged Expected
+template <bool Trivial, typename ...Es>
+struct OneOfBase;
+
+template <typename ...Es>
+struct OneOfBase<true, Es...> {
+    std::uint8_t tag;
+    OneOfUnion<true, Es...> alternatives;
+
+    constexpr OneOfBase() noexcept : tag{ ONE_OF_EMPTY_TAG }, alternatives{ } { }
+
+    template <std::size_t I, typename ...Ts>
+    constexpr OneOfBase(IndexConstant<I>, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<one_of_alternative_t<I, Es...>, Ts&&...>::value)
+    : tag{ ONE_OF_EMPTY_TAG }, alternatives{ IndexConstant<I>{ }, std::forward<Ts>(args)... } {
+        tag = static_cast<std::uint8_t>(ONE_OF_FIRST_ERROR_TAG + I);
+    }
+};
+
+template <typename ...Es>
+struct OneOfBase<false, Es...> {
+    std::uint8_t tag;
+    OneOfUnion<false, Es...> alternatives;
+
+    constexpr OneOfBase() noexcept : tag{ ONE_OF_EMPTY_TAG }, alternatives{ } { }
+
+    template <std::size_t I, typename ...Ts>
+    constexpr OneOfBase(IndexConstant<I>, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<one_of_alternative_t<I, Es...>, Ts&&...>::value)
+    : tag{ ONE_OF_EMPTY_TAG }, alternatives{ IndexConstant<I>{ }, std::forward<Ts>(args)... } {
+        tag = static_cast<std::uint8_t>(ONE_OF_FIRST_ERROR_TAG + I);
+    }
+
+    MONADS_CONSTEXPR20 ~OneOfBase() {
+        if (tag >= ONE_OF_FIRST_ERROR_TAG) {
+            one_of_dispatch<void, 0, sizeof...(Es)>(
+                static_cast<std::size_t>(tag - ONE_OF_FIRST_ERROR_TAG),
+                [this](auto i) { detail::destroy(one_of_get(this->alternatives, i)); }
+            );
+        }
+    }
+};
+
+template <typename ...Es>
+struct OneOfStorage : OneOfBase<all_of<std::is_trivially_destructible<Es>::value...>::value, Es...> {
+    using OneOfBase<
+        all_of<std::is_trivially_destructible<Es>::value...>::value,
+        Es...
+    >::OneOfBase;
+
+    constexpr std::size_t index() const noexcept {
+        return static_cast<std::size_t>(this->tag - ONE_OF_FIRST_ERROR_TAG);
+    }
+
+    template <std::size_t I>
+    constexpr one_of_alternative_t<I, Es...>& get(IndexConstant<I>) noexcept {
+        return one_of_get(this->alternatives, IndexConstant<I>{ });
+    }
+
+    template <std::size_t I>
+    constexpr const one_of_alternative_t<I, Es...>& get(IndexConstant<I>) const noexcept {
+        return one_of_get(this->alternatives, IndexConstant<I>{ });
+    }
+
+    template <std::size_t I, typename ...Ts>
+    MONADS_CONSTEXPR20 void construct(IndexConstant<I>, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<one_of_alternative_t<I, Es...>, Ts&&...>::value) {
+#ifdef MONADS_HAS_CONSTEXPR_CONSTRUCT
+        std::construct_at(std::addressof(get(IndexConstant<I>{ })), std::forward<Ts>(args)...);
+#else
+        ::new(static_cast<void*>(std::addressof(get(IndexConstant<I>{ }))))
+            one_of_alternative_t<I, Es...>(std::forward<Ts>(args)...);
+#endif
+        this->tag = static_cast<std::uint8_t>(ONE_OF_FIRST_ERROR_TAG + I);
+    }
+
+    MONADS_CONSTEXPR20 void reset() noexcept {
+        one_of_dispatch<void, 0, sizeof...(Es)>(index(), [this](auto i) {
+            detail::destroy(this->get(i));
+        });
+
+        this->tag = ONE_OF_EMPTY_TAG;
+    }
+
+    MONADS_CONSTEXPR20 void construct_from(const OneOfStorage &other)
+    noexcept(all_of<std::is_nothrow_copy_constructible<Es>::value...>::value) {
+        one_of_dispatch<void, 0, sizeof...(Es)>(other.index(), [this, &other](auto i) {
+            this->construct(i, other.get(i));
+        });
+    }
+
+    MONADS_CONSTEXPR20 void construct_from(OneOfStorage &&other) noexcept {
+        one_of_dispatch<void, 0, sizeof...(Es)>(other.index(), [this, &other](auto i) {
+            this->construct(i, std::move(other.get(i)));
+        });
+    }
+
+    // copies into a temporary first; alternatives are nothrow move
+    // constructible, so a OneOf is never left without an alternative
+    MONADS_CONSTEXPR20 void assign_from(const OneOfStorage &other)
+    noexcept(all_of<(std::is_nothrow_copy_constructible<Es>::value
+                     && std::is_nothrow_copy_assignable<Es>::value)...>::value) {
+        one_of_dispatch<void, 0, sizeof...(Es)>(other.index(), [this, &other](auto i) {
+            if (this->index() == i) {
+                this->get(i) = other.get(i);
+            } else {
+                auto copy = other.get(i);
+
+                this->reset();
+                this->construct(i, std::move(copy));
+            }
+        });
+    }
+
+    MONADS_CONSTEXPR20 void assign_from(OneOfStorage &&other)
+    noexcept(all_of<std::is_nothrow_move_assignable<Es>::value...>::value) {
+        one_of_dispatch<void, 0, sizeof...(Es)>(other.index(), [this, &other](auto i) {
+            if (this->index() == i) {
+                this->get(i) = std::move(other.get(i));
+            } else {
+                this->reset();
+                this->construct(i, std::move(other.get(i)));
+            }
+        });
+    }
+};
+
+template <typename ...Es>
+using OneOfPayload = SpecialMembers<OneOfStorage<Es...>, Es...>;
+
+struct OneOfEmptyArm {
+    std::uint8_t tag;
+};
+
+template <typename T>
+struct OneOfValueArm {
+    std::uint8_t tag;
+    T value;
+
+    template <typename ...Ts>
+    constexpr OneOfValueArm(ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
+    : tag{ ONE_OF_EMPTY_TAG }, value(std::forward<Ts>(args)...) {
+        tag = ONE_OF_VALUE_TAG;
+    }
+};
+
+// every arm is standard-layout and begins with a std::uint8_t, so the active
+// arm's tag can be read through monostate (the common initial sequence); a
+// constant evaluation may only read the active arm, so it looks that up first
+template <typename U>
+constexpr std::uint8_t one_of_expected_tag(const U &arms) noexcept {
+#ifdef MONADS_HAS_ACTIVE_MEMBER_QUERY
+    if (__builtin_is_constant_evaluated()) {
+        if (__builtin_constant_p(arms.value_arm.tag)) {
+            return arms.value_arm.tag;
+        } else if (__builtin_constant_p(arms.monostate.tag)) {
+            return arms.monostate.tag;
+        }
+
+        return static_cast<std::uint8_t>(ONE_OF_FIRST_ERROR_TAG + arms.error.index());
+    }
+#endif
+
+    return arms.monostate.tag;
+}
+
+template <
+    typename T,
+    typename O,
+    bool = std::is_trivially_destructible<T>::value
+           && std::is_trivially_destructible<O>::value
+>
+struct OneOfExpectedUnion {
+    union {
+        OneOfEmptyArm monostate;
+        OneOfValueArm<T> value_arm;
+        O error;
+    };
+
+    constexpr OneOfExpectedUnion() noexcept : monostate{ ONE_OF_EMPTY_TAG } { }
+
+    template <typename ...Ts, std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0>
+    constexpr OneOfExpectedUnion(ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
+    : value_arm{ ValueTag{ }, std::forward<Ts>(args)... } { }
+
+    template <typename ...Ts, std::enable_if_t<std::is_constructible<O, Ts&&...>::value, int> = 0>
+    constexpr OneOfExpectedUnion(ErrorTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<O, Ts&&...>::value)
+    : error(std::forward<Ts>(args)...) { }
+
+    constexpr std::uint8_t tag() const noexcept {
+        return one_of_expected_tag(*this);
+    }
+};
+
+template <typename T, typename O>
+struct OneOfExpectedUnion<T, O, false> {
+    union {
+        OneOfEmptyArm monostate;
+        OneOfValueArm<T> value_arm;
+        O error;
+    };
+
+    constexpr OneOfExpectedUnion() noexcept : monostate{ ONE_OF_EMPTY_TAG } { }
+
+    template <typename ...Ts, std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0>
+    constexpr OneOfExpectedUnion(ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
+    : value_arm{ ValueTag{ }, std::forward<Ts>(args)... } { }
+
+    template <typename ...Ts, std::enable_if_t<std::is_constructible<O, Ts&&...>::value, int> = 0>
+    constexpr OneOfExpectedUnion(ErrorTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<O, Ts&&...>::value)
+    : error(std::forward<Ts>(args)...) { }
+
+    MONADS_CONSTEXPR20 ~OneOfExpectedUnion() {
+        if (tag() == ONE_OF_VALUE_TAG) {
+            detail::destroy(value_arm);
+        } else if (tag() >= ONE_OF_FIRST_ERROR_TAG) {
+            detail::destroy(error);
+        }
+    }
+
+    constexpr std::uint8_t tag() const noexcept {
+        return one_of_expected_tag(*this);
+    }
+};
+
+template <typename T, typename O>
+struct OneOfExpectedStorage : OneOfExpectedUnion<T, O> {
+    using OneOfExpectedUnion<T, O>::OneOfExpectedUnion;
+
+    constexpr bool has_value() const noexcept {
+        return this->tag() == ONE_OF_VALUE_TAG;
+    }
+
+    constexpr bool has_error() const noexcept {
+        return this->tag() >= ONE_OF_FIRST_ERROR_TAG;
+    }
+
+    template <typename ...Ts>
+    constexpr T& construct(ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+#ifdef MONADS_HAS_CONSTEXPR_CONSTRUCT
+        std::construct_at(std::addressof(this->value_arm), ValueTag{ },
+                          std::forward<Ts>(args)...);
+#else
+        construct_impl(IsTriviallyReplaceable{ }, ValueTag{ }, std::forward<Ts>(args)...);
+#endif
+
+        return this->value_arm.value;
+    }
+
+    template <typename ...Ts>
+    constexpr O& construct(ErrorTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<O, Ts&&...>::value) {
+#ifdef MONADS_HAS_CONSTEXPR_CONSTRUCT
+        std::construct_at(std::addressof(this->error), std::forward<Ts>(args)...);
+#else
+        construct_impl(IsTriviallyReplaceable{ }, ErrorTag{ }, std::forward<Ts>(args)...);
+#endif
+
+        return this->error;
+    }
+
+    constexpr T& get(ValueTag) noexcept {
+        return this->value_arm.value;
+    }
+
+    constexpr const T& get(ValueTag) const noexcept {
+        return this->value_arm.value;
+    }
+
+    constexpr O& get(ErrorTag) noexcept {
+        return this->error;
+    }
+
+    constexpr const O& get(ErrorTag) const noexcept {
+        return this->error;
+    }
+
+    constexpr void reset() noexcept {
+        if (has_value()) {
+            detail::destroy(this->value_arm);
+        } else if (has_error()) {
+            detail::destroy(this->error);
+        }
+
+#ifdef MONADS_HAS_CONSTEXPR_CONSTRUCT
+        std::construct_at(std::addressof(this->monostate), OneOfEmptyArm{ ONE_OF_EMPTY_TAG });
+#else
+        reset_impl(IsTriviallyReplaceable{ });
+#endif
+    }
+
+    constexpr void construct_from(const OneOfExpectedStorage &other)
+    noexcept(std::is_nothrow_copy_constructible<T>::value
+             && std::is_nothrow_copy_constructible<O>::value) {
+        if (other.has_value()) {
+            construct(ValueTag{ }, other.get(ValueTag{ }));
+        } else if (other.has_error()) {
+            construct(ErrorTag{ }, other.error);
+        }
+    }
+
+    constexpr void construct_from(OneOfExpectedStorage &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value
+             && std::is_nothrow_move_constructible<O>::value) {
+        if (other.has_value()) {
+            construct(ValueTag{ }, std::move(other.get(ValueTag{ })));
+        } else if (other.has_error()) {
+            construct(ErrorTag{ }, std::move(other.error));
+        }
+    }
+
+    constexpr void assign_from(const OneOfExpectedStorage &other)
+    noexcept(std::is_nothrow_copy_constructible<T>::value
+             && std::is_nothrow_copy_constructible<O>::value
+             && std::is_nothrow_copy_assignable<T>::value
+             && std::is_nothrow_copy_assignable<O>::value) {
+        if (other.has_value() && has_value()) {
+            get(ValueTag{ }) = other.get(ValueTag{ });
+        } else if (other.has_error() && has_error()) {
+            this->error = other.error;
+        } else {
+            reset();
+            construct_from(other);
+        }
+    }
+
+    constexpr void assign_from(OneOfExpectedStorage &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value
+             && std::is_nothrow_move_constructible<O>::value
+             && std::is_nothrow_move_assignable<T>::value
+             && std::is_nothrow_move_assignable<O>::value) {
+        if (other.has_value() && has_value()) {
+            get(ValueTag{ }) = std::move(other.get(ValueTag{ }));
+        } else if (other.has_error() && has_error()) {
+            this->error = std::move(other.error);
+        } else {
+            reset();
+            construct_from(std::move(other));
+        }
+    }
+
+private:
+    using IsTriviallyReplaceable = all_of<
+        is_trivially_replaceable<T>::value,
+        is_trivially_replaceable<O>::value
+    >;
+
+    template <typename Tag, typename ...Ts>
+    constexpr void construct_impl(std::true_type, Tag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<OneOfExpectedUnion<T, O>, Tag, Ts&&...>::value) {
+        static_cast<OneOfExpectedUnion<T, O>&>(*this) =
+            OneOfExpectedUnion<T, O>{ Tag{ }, std::forward<Ts>(args)... };
+    }
+
+    template <typename ...Ts>
+    void construct_impl(std::false_type, ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+        ::new(static_cast<void*>(std::addressof(this->value_arm)))
+            OneOfValueArm<T>(ValueTag{ }, std::forward<Ts>(args)...);
+    }
+
+    template <typename ...Ts>
+    void construct_impl(std::false_type, ErrorTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<O, Ts&&...>::value) {
+        ::new(static_cast<void*>(std::addressof(this->error))) O(std::forward<Ts>(args)...);
+    }
+
+    constexpr void reset_impl(std::true_type) noexcept {
+        static_cast<OneOfExpectedUnion<T, O>&>(*this) = OneOfExpectedUnion<T, O>{ };
+    }
+
+    void reset_impl(std::false_type) noexcept {
+        ::new(static_cast<void*>(std::addressof(this->monostate)))
+            OneOfEmptyArm{ ONE_OF_EMPTY_TAG };
+    }
+};
+
+// types that are not standard-layout keep the generic storage and its separate
+// state member, as does every type where the merged storage could not be used
+// in a constant expression
+#ifdef MONADS_HAS_ACTIVE_MEMBER_QUERY
+template <typename T, typename ...Es>
+struct expected_storage<T, OneOf<Es...>, std::enable_if_t<
+    std::is_standard_layout<OneOfValueArm<T>>::value
+    && std::is_standard_layout<OneOf<Es...>>::value
+>> {
+    using type = OneOfExpectedStorage<T, OneOf<Es...>>;
+};
+#endif
+
+} // namespace detail
+} // namespace monads
+
+#endif
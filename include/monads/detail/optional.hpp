@@ -33,108 +33,145 @@
 #define MONADS_DETAIL_OPTIONAL_HPP
 
 #include <monads/detail/common.hpp>
+#include <monads/detail/special_members.hpp>
 
 #include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace monads {
 namespace detail {
 
-template <typename T, typename = void>
-struct OptionalStorage {
-	union {
-		Monostate monostate;
-		T value;
-	};
+template <typename T, bool = std::is_trivially_destructible<T>::value>
+struct OptionalUnion {
+    union {
+        Monostate monostate;
+        T value;
+    };
 
-	bool has_value = false;
+    bool has_value = false;
 
-	constexpr OptionalStorage() noexcept : monostate{ } { }
+    constexpr OptionalUnion() noexcept : monostate{ } { }
 
     template <
-    	typename ...Ts,
-    	std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int
-    > = 0>
-    constexpr OptionalStorage(ValueTag, Ts &&...args)
+        typename ...Ts,
+        std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0
+    >
+    constexpr OptionalUnion(ValueTag, Ts &&...args)
     noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
     : value(std::forward<Ts>(args)...), has_value{ true } { }
+};
+
+template <typename T>
+struct OptionalUnion<T, false> {
+    union {
+        Monostate monostate;
+        T value;
+    };
+
+    bool has_value = false;
+
+    constexpr OptionalUnion() noexcept : monostate{ } { }
 
     template <
-    	typename U,
-    	typename ...Ts,
-    	std::enable_if_t<std::is_constructible<
-	    	T,
-	    	std::initializer_list<U>&,
-	    	Ts&&...
-	    >::value, int> = 0
-	>
-    constexpr OptionalStorage(ValueTag, std::initializer_list<U> list,
-    						  Ts &&...args)
-    noexcept(std::is_nothrow_constructible<
-    	T,
-    	std::initializer_list<U>&,
-    	Ts&&...
-    >::value)
-    : value(list, std::forward<Ts>(args)...), has_value{ true } { }
+        typename ...Ts,
+        std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0
+    >
+    constexpr OptionalUnion(ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
+    : value(std::forward<Ts>(args)...), has_value{ true } { }
 
-    constexpr void reset() noexcept {
-        has_value = false;
+    MONADS_CONSTEXPR20 ~OptionalUnion() {
+        if (has_value) {
+            detail::destroy(value);
+        }
     }
 };
 
 template <typename T>
-struct OptionalStorage<T, void_t<std::enable_if_t<
-    !std::is_trivially_destructible<T>::value
->>> {
-	union {
-		Monostate monostate;
-		T value;
-	};
+struct OptionalStorage : OptionalUnion<T> {
+    using OptionalUnion<T>::OptionalUnion;
+
+    template <typename ...Ts>
+    constexpr T& construct(ValueTag, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+#ifdef MONADS_HAS_CONSTEXPR_CONSTRUCT
+        std::construct_at(std::addressof(this->value), std::forward<Ts>(args)...);
+        this->has_value = true;
+#else
+        construct_impl(is_trivially_replaceable<T>{ }, std::forward<Ts>(args)...);
+#endif
+
+        return this->value;
+    }
+
+    constexpr void reset() noexcept {
+        if (this->has_value) {
+            detail::destroy(this->value);
+            this->has_value = false;
+        }
+    }
 
-	bool has_value = false;
+    constexpr void construct_from(const OptionalStorage &other)
+    noexcept(std::is_nothrow_copy_constructible<T>::value) {
+        if (other.has_value) {
+            construct(ValueTag{ }, other.value);
+        }
+    }
 
-	constexpr OptionalStorage() noexcept : monostate{ } { }
+    constexpr void construct_from(OptionalStorage &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (other.has_value) {
+            construct(ValueTag{ }, std::move(other.value));
+        }
+    }
 
-    template <
-    	typename ...Ts,
-    	std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int
-    > = 0>
-    constexpr OptionalStorage(ValueTag, Ts &&...args)
-    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
-    : value(std::forward<Ts>(args)...), has_value{ true } { }
+    constexpr void assign_from(const OptionalStorage &other)
+    noexcept(std::is_nothrow_copy_constructible<T>::value
+             && std::is_nothrow_copy_assignable<T>::value) {
+        if (!other.has_value) {
+            reset();
+        } else if (this->has_value) {
+            this->value = other.value;
+        } else {
+            construct(ValueTag{ }, other.value);
+        }
+    }
 
-    template <
-    	typename U,
-    	typename ...Ts,
-    	std::enable_if_t<std::is_constructible<
-	    	T,
-	    	std::initializer_list<U>&,
-	    	Ts&&...
-	    >::value, int> = 0
-	>
-    constexpr OptionalStorage(ValueTag, std::initializer_list<U> list,
-    						  Ts &&...args)
-    noexcept(std::is_nothrow_constructible<
-    	T,
-    	std::initializer_list<U>&,
-    	Ts&&...
-    >::value)
-    : value(list, std::forward<Ts>(args)...), has_value{ true } { }
-
-    ~OptionalStorage() {
-    	reset();
+    constexpr void assign_from(OptionalStorage &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value
+             && std::is_nothrow_move_assignable<T>::value) {
+        if (!other.has_value) {
+            reset();
+        } else if (this->has_value) {
+            this->value = std::move(other.value);
+        } else {
+            construct(ValueTag{ }, std::move(other.value));
+        }
     }
 
-    void reset() noexcept {
-    	if (!has_value) {
-    		return;
-    	}
+private:
+    template <typename ...Ts>
+    constexpr void construct_impl(std::true_type, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+        static_cast<OptionalUnion<T>&>(*this) =
+            OptionalUnion<T>{ ValueTag{ }, std::forward<Ts>(args)... };
+    }
 
-    	value.T::~T();
-        has_value = false;
+    template <typename ...Ts>
+    void construct_impl(std::false_type, Ts &&...args)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
+        ::new(static_cast<void*>(std::addressof(this->value)))
+            T(std::forward<Ts>(args)...);
+        this->has_value = true;
     }
 };
 
+template <typename T>
+using OptionalPayload = SpecialMembers<OptionalStorage<T>, T>;
+
 } // namespace detail
 } // namespace monads
 
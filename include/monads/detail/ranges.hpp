@@ -0,0 +1,397 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_RANGES_HPP
+#define MONADS_DETAIL_RANGES_HPP
+
+#include <monads/optional.hpp>
+
+#include <monads/detail/invoke.hpp>
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if !defined(MONADS_NO_RANGES) && defined(__cpp_lib_ranges)
+#include <ranges>
+#define MONADS_HAS_RANGES
+#endif
+
+namespace monads {
+namespace detail {
+
+#ifdef MONADS_HAS_RANGES
+struct ViewBase : std::ranges::view_base { };
+#else
+struct ViewBase { };
+#endif
+
+template <typename I>
+using iterator_category_t = typename std::iterator_traits<I>::iterator_category;
+
+template <typename I, typename Tag>
+struct has_iterator_category : std::is_base_of<Tag, iterator_category_t<I>> { };
+
+template <typename I, typename Tag>
+using clamp_iterator_category_t = std::conditional_t<
+    has_iterator_category<I, Tag>::value,
+    Tag,
+    iterator_category_t<I>
+>;
+
+template <typename I, typename Tag>
+using clamp_iterator_concept_t = std::conditional_t<
+    std::is_base_of<Tag, iterator_concept_t<I>>::value,
+    Tag,
+    iterator_concept_t<I>
+>;
+
+template <typename R>
+class RangeRef {
+public:
+    RangeRef() = default;
+
+    explicit RangeRef(R &&range) noexcept(std::is_nothrow_move_constructible<R>::value)
+    : range_(std::move(range)) { }
+
+    R& get() noexcept {
+        return range_;
+    }
+
+    const R& get() const noexcept {
+        return range_;
+    }
+
+private:
+    R range_;
+};
+
+template <typename R>
+class RangeRef<R&> {
+public:
+    RangeRef() = default;
+
+    explicit RangeRef(R &range) noexcept : range_{ std::addressof(range) } { }
+
+    R& get() const noexcept {
+        return *range_;
+    }
+
+private:
+    R *range_ = nullptr;
+};
+
+struct ValuesPolicy {
+    template <typename M>
+    static bool accept(const M &monad) noexcept {
+        return monad.has_value();
+    }
+
+    template <typename M>
+    static decltype(auto) project(M &&monad) noexcept {
+        return std::forward<M>(monad).unwrap();
+    }
+};
+
+struct ErrorsPolicy {
+    template <typename M>
+    static bool accept(const M &monad) noexcept {
+        return monad.has_error();
+    }
+
+    template <typename M>
+    static decltype(auto) project(M &&monad) noexcept {
+        return std::forward<M>(monad).unwrap_error();
+    }
+};
+
+template <typename I, typename Policy>
+class FilterIterator {
+    using BaseReference = iterator_reference_t<I>;
+    using Projected = decltype(Policy::project(std::declval<BaseReference>()));
+
+public:
+    // the legacy categories above input require reference to be a reference
+    using iterator_category = std::conditional_t<
+        std::is_lvalue_reference<BaseReference>::value,
+        clamp_iterator_category_t<I, std::bidirectional_iterator_tag>,
+        std::input_iterator_tag
+    >;
+    using iterator_concept = clamp_iterator_concept_t<I, std::bidirectional_iterator_tag>;
+    using reference = std::conditional_t<
+        std::is_lvalue_reference<BaseReference>::value,
+        Projected,
+        std::decay_t<Projected>
+    >;
+    using value_type = std::decay_t<Projected>;
+    using difference_type = typename std::iterator_traits<I>::difference_type;
+    using pointer = void;
+
+    FilterIterator() = default;
+
+    FilterIterator(I current, I last) : current_{ std::move(current) }, last_{ std::move(last) } {
+        satisfy();
+    }
+
+    reference operator*() const {
+        return Policy::project(*current_);
+    }
+
+    FilterIterator& operator++() {
+        ++current_;
+        satisfy();
+
+        return *this;
+    }
+
+    FilterIterator operator++(int) {
+        FilterIterator previous = *this;
+        ++*this;
+
+        return previous;
+    }
+
+    FilterIterator& operator--() {
+        do {
+            --current_;
+        } while (!Policy::accept(*current_));
+
+        return *this;
+    }
+
+    FilterIterator operator--(int) {
+        FilterIterator previous = *this;
+        --*this;
+
+        return previous;
+    }
+
+    friend bool operator==(const FilterIterator &lhs, const FilterIterator &rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+
+    friend bool operator!=(const FilterIterator &lhs, const FilterIterator &rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    void satisfy() {
+        while (current_ != last_ && !Policy::accept(*current_)) {
+            ++current_;
+        }
+    }
+
+    I current_{ };
+    I last_{ };
+};
+
+template <typename I, typename F>
+class FilterMapIterator {
+    using Result = std::decay_t<invoke_result_t<const F&, iterator_reference_t<I>>>;
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = clamp_iterator_concept_t<I, std::forward_iterator_tag>;
+    using value_type = std::decay_t<decltype(std::declval<Result&>().unwrap())>;
+    using reference = const value_type&;
+    using difference_type = typename std::iterator_traits<I>::difference_type;
+    using pointer = const value_type*;
+
+    FilterMapIterator() = default;
+
+    FilterMapIterator(I current, I last, const F &callable)
+    : current_{ std::move(current) }, last_{ std::move(last) },
+      callable_{ std::addressof(callable) } {
+        satisfy();
+    }
+
+    reference operator*() const noexcept {
+        return *cached_;
+    }
+
+    pointer operator->() const noexcept {
+        return std::addressof(*cached_);
+    }
+
+    FilterMapIterator& operator++() {
+        ++current_;
+        satisfy();
+
+        return *this;
+    }
+
+    FilterMapIterator operator++(int) {
+        FilterMapIterator previous = *this;
+        ++*this;
+
+        return previous;
+    }
+
+    friend bool operator==(const FilterMapIterator &lhs, const FilterMapIterator &rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+
+    friend bool operator!=(const FilterMapIterator &lhs, const FilterMapIterator &rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    void satisfy() {
+        cached_.reset();
+
+        for (; current_ != last_; ++current_) {
+            Result result = invoke(*callable_, *current_);
+
+            if (result.has_value()) {
+                cached_.emplace(std::move(result).unwrap());
+
+                return;
+            }
+        }
+    }
+
+    I current_{ };
+    I last_{ };
+    const F *callable_ = nullptr;
+    Optional<value_type> cached_;
+};
+
+template <typename I, typename F>
+class TransformIterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = clamp_iterator_concept_t<I, std::random_access_iterator_tag>;
+    using reference = decltype(std::declval<iterator_reference_t<I>>().map(std::declval<const F&>()));
+    using value_type = reference;
+    using difference_type = typename std::iterator_traits<I>::difference_type;
+    using pointer = void;
+
+    TransformIterator() = default;
+
+    TransformIterator(I current, const F &callable)
+    : current_{ std::move(current) }, callable_{ std::addressof(callable) } { }
+
+    reference operator*() const {
+        return (*current_).map(*callable_);
+    }
+
+    reference operator[](difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    TransformIterator& operator++() {
+        ++current_;
+
+        return *this;
+    }
+
+    TransformIterator operator++(int) {
+        TransformIterator previous = *this;
+        ++current_;
+
+        return previous;
+    }
+
+    TransformIterator& operator--() {
+        --current_;
+
+        return *this;
+    }
+
+    TransformIterator operator--(int) {
+        TransformIterator previous = *this;
+        --current_;
+
+        return previous;
+    }
+
+    TransformIterator& operator+=(difference_type offset) {
+        current_ += offset;
+
+        return *this;
+    }
+
+    TransformIterator& operator-=(difference_type offset) {
+        current_ -= offset;
+
+        return *this;
+    }
+
+    friend TransformIterator operator+(TransformIterator iter, difference_type offset) {
+        return iter += offset;
+    }
+
+    friend TransformIterator operator+(difference_type offset, TransformIterator iter) {
+        return iter += offset;
+    }
+
+    friend TransformIterator operator-(TransformIterator iter, difference_type offset) {
+        return iter -= offset;
+    }
+
+    friend difference_type operator-(const TransformIterator &lhs, const TransformIterator &rhs) {
+        return lhs.current_ - rhs.current_;
+    }
+
+    friend bool operator==(const TransformIterator &lhs, const TransformIterator &rhs) {
+        return lhs.current_ == rhs.current_;
+    }
+
+    friend bool operator!=(const TransformIterator &lhs, const TransformIterator &rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const TransformIterator &lhs, const TransformIterator &rhs) {
+        return lhs.current_ < rhs.current_;
+    }
+
+    friend bool operator>(const TransformIterator &lhs, const TransformIterator &rhs) {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const TransformIterator &lhs, const TransformIterator &rhs) {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const TransformIterator &lhs, const TransformIterator &rhs) {
+        return !(lhs < rhs);
+    }
+
+private:
+    I current_{ };
+    const F *callable_ = nullptr;
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
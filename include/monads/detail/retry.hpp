@@ -0,0 +1,90 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_RETRY_HPP
+#define MONADS_DETAIL_RETRY_HPP
+
+#include <monads/expected.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <type_traits>
+
+namespace monads {
+namespace detail {
+
+template <typename T, typename E>
+struct is_expected_with_error : std::false_type { };
+
+template <typename T, typename E>
+struct is_expected_with_error<Expected<T, E>, E> : std::true_type { };
+
+template <typename URNG>
+std::chrono::nanoseconds backoff_delay(
+    std::chrono::nanoseconds initial,
+    std::chrono::nanoseconds maximum,
+    double multiplier,
+    double jitter,
+    std::size_t attempt,
+    URNG &engine
+) {
+    const double exponent = static_cast<double>(attempt == 0 ? 0 : attempt - 1);
+    const double unbounded =
+        static_cast<double>(initial.count()) * std::pow(multiplier, exponent);
+    double delay = std::min(unbounded, static_cast<double>(maximum.count()));
+
+    if (jitter > 0) {
+        std::uniform_real_distribution<double> distribution{
+            0.0,
+            std::min(jitter, 1.0)
+        };
+
+        delay -= delay * distribution(engine);
+    }
+
+    return std::chrono::nanoseconds{
+        static_cast<std::chrono::nanoseconds::rep>(delay)
+    };
+}
+
+inline std::minstd_rand& jitter_engine() {
+    thread_local std::minstd_rand engine{ std::random_device{ }() };
+
+    return engine;
+}
+
+} // namespace detail
+} // namespace monads
+
+#endif
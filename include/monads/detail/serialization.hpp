@@ -0,0 +1,111 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_SERIALIZATION_HPP
+#define MONADS_DETAIL_SERIALIZATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace monads {
+namespace detail {
+
+constexpr std::uint32_t SERIAL_MAGIC = 0x4d4e4453;
+
+constexpr std::uint32_t SERIAL_MAGIC_SWAPPED = 0x53444e4d;
+
+constexpr std::uint8_t SERIAL_VERSION = 1;
+
+enum class SerialKind : std::uint8_t {
+    Optional = 1,
+    Expected = 2
+};
+
+enum class SerialState : std::uint8_t {
+    Empty = 0,
+    Value = 1,
+    Error = 2
+};
+
+struct SerialHeader {
+    std::uint32_t magic;
+    std::uint8_t version;
+    std::uint8_t byte_order;
+    std::uint8_t kind;
+    std::uint8_t alignment;
+    std::uint32_t value_size;
+    std::uint32_t error_size;
+};
+
+static_assert(sizeof(SerialHeader) == 16, "SerialHeader must be packed into 16 bytes");
+
+// the largest alignment SerialHeader::alignment can record
+constexpr std::size_t SERIAL_MAX_ALIGNMENT = 0xff;
+
+inline std::uint8_t native_byte_order() noexcept {
+    const std::uint16_t probe = 1;
+    unsigned char first = 0;
+    std::memcpy(&first, &probe, 1);
+
+    return first == 1 ? 0 : 1;
+}
+
+constexpr std::size_t max_size(std::size_t lhs, std::size_t rhs) noexcept {
+    return lhs < rhs ? rhs : lhs;
+}
+
+constexpr std::size_t round_up(std::size_t offset, std::size_t alignment) noexcept {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+struct SerialLayout {
+    std::size_t alignment;
+    std::size_t value_size;
+    std::size_t error_size;
+
+    constexpr std::size_t state_offset() const noexcept {
+        return sizeof(SerialHeader);
+    }
+
+    constexpr std::size_t payload_offset() const noexcept {
+        return round_up(sizeof(SerialHeader) + 1, alignment);
+    }
+
+    constexpr std::size_t size() const noexcept {
+        return payload_offset() + max_size(value_size, error_size);
+    }
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
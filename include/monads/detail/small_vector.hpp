@@ -0,0 +1,310 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_SMALL_VECTOR_HPP
+#define MONADS_DETAIL_SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+namespace detail {
+
+template <typename T, std::size_t N>
+class SmallVector {
+public:
+    static_assert(N > 0, "SmallVector must have a non-zero inline capacity");
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() noexcept = default;
+
+    SmallVector(std::initializer_list<T> list) {
+        reserve(list.size());
+
+        for (const T &elem : list) {
+            push_back(elem);
+        }
+    }
+
+    SmallVector(const SmallVector &other) {
+        reserve(other.size());
+
+        for (const T &elem : other) {
+            push_back(elem);
+        }
+    }
+
+    SmallVector(SmallVector &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value) {
+        take(std::move(other));
+    }
+
+    ~SmallVector() {
+        clear();
+        release();
+    }
+
+    SmallVector& operator=(const SmallVector &other) {
+        if (this != &other) {
+            SmallVector copy(other);
+
+            clear();
+            take(std::move(copy));
+        }
+
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            take(std::move(other));
+        }
+
+        return *this;
+    }
+
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    bool is_inline() const noexcept {
+        return data_ == inline_data();
+    }
+
+    T* data() noexcept {
+        return data_;
+    }
+
+    const T* data() const noexcept {
+        return data_;
+    }
+
+    iterator begin() noexcept {
+        return data_;
+    }
+
+    const_iterator begin() const noexcept {
+        return data_;
+    }
+
+    iterator end() noexcept {
+        return data_ + size_;
+    }
+
+    const_iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    T& operator[](size_type index) noexcept {
+        return data_[index];
+    }
+
+    const T& operator[](size_type index) const noexcept {
+        return data_[index];
+    }
+
+    T& front() noexcept {
+        return data_[0];
+    }
+
+    const T& front() const noexcept {
+        return data_[0];
+    }
+
+    T& back() noexcept {
+        return data_[size_ - 1];
+    }
+
+    const T& back() const noexcept {
+        return data_[size_ - 1];
+    }
+
+    void reserve(size_type requested) {
+        if (requested <= capacity_) {
+            return;
+        }
+
+        T *const allocated = static_cast<T*>(::operator new(requested * sizeof(T)));
+        size_type moved = 0;
+
+        try {
+            for (; moved < size_; ++moved) {
+                ::new(static_cast<void*>(allocated + moved))
+                    T(std::move_if_noexcept(data_[moved]));
+            }
+        } catch (...) {
+            destroy(allocated, allocated + moved);
+            ::operator delete(allocated);
+
+            throw;
+        }
+
+        destroy(data_, data_ + size_);
+        release();
+
+        data_ = allocated;
+        capacity_ = requested;
+    }
+
+    template <typename ...Ts>
+    T& emplace_back(Ts &&...ts) {
+        if (size_ == capacity_) {
+            T elem(std::forward<Ts>(ts)...);
+            reserve(capacity_ * 2);
+
+            return construct_back(std::move(elem));
+        }
+
+        return construct_back(std::forward<Ts>(ts)...);
+    }
+
+    void push_back(const T &elem) {
+        emplace_back(elem);
+    }
+
+    void push_back(T &&elem) {
+        emplace_back(std::move(elem));
+    }
+
+    void pop_back() noexcept {
+        --size_;
+        data_[size_].~T();
+    }
+
+    void clear() noexcept {
+        destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+private:
+    template <typename ...Ts>
+    T& construct_back(Ts &&...ts) {
+        T *const slot = ::new(static_cast<void*>(data_ + size_))
+            T(std::forward<Ts>(ts)...);
+        ++size_;
+
+        return *slot;
+    }
+
+    static void destroy(T *first, T *last) noexcept {
+        for (; first != last; ++first) {
+            first->~T();
+        }
+    }
+
+    T* inline_data() noexcept {
+        return reinterpret_cast<T*>(&inline_);
+    }
+
+    const T* inline_data() const noexcept {
+        return reinterpret_cast<const T*>(&inline_);
+    }
+
+    void release() noexcept {
+        if (!is_inline()) {
+            ::operator delete(data_);
+            data_ = inline_data();
+            capacity_ = N;
+        }
+    }
+
+    void take(SmallVector &&other)
+    noexcept(std::is_nothrow_move_constructible<T>::value) {
+        release();
+
+        if (!other.is_inline()) {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+
+            other.data_ = other.inline_data();
+            other.size_ = 0;
+            other.capacity_ = N;
+
+            return;
+        }
+
+        for (T &elem : other) {
+            ::new(static_cast<void*>(data_ + size_)) T(std::move(elem));
+            ++size_;
+        }
+
+        other.clear();
+    }
+
+    std::aligned_storage_t<sizeof(T) * N, alignof(T)> inline_;
+    T *data_ = inline_data();
+    size_type size_ = 0;
+    size_type capacity_ = N;
+};
+
+template <typename T, std::size_t N, std::size_t M>
+bool operator==(const SmallVector<T, N> &lhs, const SmallVector<T, M> &rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        if (!(lhs[i] == rhs[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T, std::size_t N, std::size_t M>
+bool operator!=(const SmallVector<T, N> &lhs, const SmallVector<T, M> &rhs) {
+    return !(lhs == rhs);
+}
+
+} // namespace detail
+} // namespace monads
+
+#endif
@@ -0,0 +1,265 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_SPECIAL_MEMBERS_HPP
+#define MONADS_DETAIL_SPECIAL_MEMBERS_HPP
+
+#include <monads/detail/common.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+namespace detail {
+
+enum class SpecialMember {
+    Trivial,
+    NonTrivial,
+    Deleted
+};
+
+template <typename ...Ts>
+struct copy_construct_kind : std::integral_constant<
+    SpecialMember,
+    !all_of<std::is_copy_constructible<Ts>::value...>::value ? SpecialMember::Deleted
+    : all_of<std::is_trivially_copy_constructible<Ts>::value...>::value
+        ? SpecialMember::Trivial
+        : SpecialMember::NonTrivial
+> { };
+
+template <typename ...Ts>
+struct move_construct_kind : std::integral_constant<
+    SpecialMember,
+    !all_of<std::is_move_constructible<Ts>::value...>::value ? SpecialMember::Deleted
+    : all_of<std::is_trivially_move_constructible<Ts>::value...>::value
+        ? SpecialMember::Trivial
+        : SpecialMember::NonTrivial
+> { };
+
+template <typename ...Ts>
+struct copy_assign_kind : std::integral_constant<
+    SpecialMember,
+    !all_of<(std::is_copy_constructible<Ts>::value
+             && std::is_copy_assignable<Ts>::value)...>::value ? SpecialMember::Deleted
+    : all_of<(std::is_trivially_copy_constructible<Ts>::value
+              && std::is_trivially_copy_assignable<Ts>::value
+              && std::is_trivially_destructible<Ts>::value)...>::value
+        ? SpecialMember::Trivial
+        : SpecialMember::NonTrivial
+> { };
+
+template <typename ...Ts>
+struct move_assign_kind : std::integral_constant<
+    SpecialMember,
+    !all_of<(std::is_move_constructible<Ts>::value
+             && std::is_move_assignable<Ts>::value)...>::value ? SpecialMember::Deleted
+    : all_of<(std::is_trivially_move_constructible<Ts>::value
+              && std::is_trivially_move_assignable<Ts>::value
+              && std::is_trivially_destructible<Ts>::value)...>::value
+        ? SpecialMember::Trivial
+        : SpecialMember::NonTrivial
+> { };
+
+template <typename Base, SpecialMember Kind, bool Nothrow>
+struct CopyConstructLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base, bool Nothrow>
+struct CopyConstructLayer<Base, SpecialMember::NonTrivial, Nothrow> : Base {
+    using Base::Base;
+
+    CopyConstructLayer() = default;
+
+    constexpr CopyConstructLayer(const CopyConstructLayer &other) noexcept(Nothrow)
+    : Base{ } {
+        this->construct_from(other);
+    }
+
+    CopyConstructLayer(CopyConstructLayer &&other) = default;
+
+    CopyConstructLayer& operator=(const CopyConstructLayer &other) = default;
+
+    CopyConstructLayer& operator=(CopyConstructLayer &&other) = default;
+};
+
+template <typename Base, bool Nothrow>
+struct CopyConstructLayer<Base, SpecialMember::Deleted, Nothrow> : Base {
+    using Base::Base;
+
+    CopyConstructLayer() = default;
+
+    CopyConstructLayer(const CopyConstructLayer &other) = delete;
+
+    CopyConstructLayer(CopyConstructLayer &&other) = default;
+
+    CopyConstructLayer& operator=(const CopyConstructLayer &other) = default;
+
+    CopyConstructLayer& operator=(CopyConstructLayer &&other) = default;
+};
+
+template <typename Base, SpecialMember Kind, bool Nothrow>
+struct MoveConstructLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base, bool Nothrow>
+struct MoveConstructLayer<Base, SpecialMember::NonTrivial, Nothrow> : Base {
+    using Base::Base;
+
+    MoveConstructLayer() = default;
+
+    MoveConstructLayer(const MoveConstructLayer &other) = default;
+
+    constexpr MoveConstructLayer(MoveConstructLayer &&other) noexcept(Nothrow)
+    : Base{ } {
+        this->construct_from(std::move(other));
+    }
+
+    MoveConstructLayer& operator=(const MoveConstructLayer &other) = default;
+
+    MoveConstructLayer& operator=(MoveConstructLayer &&other) = default;
+};
+
+template <typename Base, bool Nothrow>
+struct MoveConstructLayer<Base, SpecialMember::Deleted, Nothrow> : Base {
+    using Base::Base;
+
+    MoveConstructLayer() = default;
+
+    MoveConstructLayer(const MoveConstructLayer &other) = default;
+
+    MoveConstructLayer& operator=(const MoveConstructLayer &other) = default;
+
+    MoveConstructLayer& operator=(MoveConstructLayer &&other) = default;
+};
+
+template <typename Base, SpecialMember Kind, bool Nothrow>
+struct CopyAssignLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base, bool Nothrow>
+struct CopyAssignLayer<Base, SpecialMember::NonTrivial, Nothrow> : Base {
+    using Base::Base;
+
+    CopyAssignLayer() = default;
+
+    CopyAssignLayer(const CopyAssignLayer &other) = default;
+
+    CopyAssignLayer(CopyAssignLayer &&other) = default;
+
+    constexpr CopyAssignLayer& operator=(const CopyAssignLayer &other) noexcept(Nothrow) {
+        this->assign_from(other);
+
+        return *this;
+    }
+
+    CopyAssignLayer& operator=(CopyAssignLayer &&other) = default;
+};
+
+template <typename Base, bool Nothrow>
+struct CopyAssignLayer<Base, SpecialMember::Deleted, Nothrow> : Base {
+    using Base::Base;
+
+    CopyAssignLayer() = default;
+
+    CopyAssignLayer(const CopyAssignLayer &other) = default;
+
+    CopyAssignLayer(CopyAssignLayer &&other) = default;
+
+    CopyAssignLayer& operator=(const CopyAssignLayer &other) = delete;
+
+    CopyAssignLayer& operator=(CopyAssignLayer &&other) = default;
+};
+
+template <typename Base, SpecialMember Kind, bool Nothrow>
+struct MoveAssignLayer : Base {
+    using Base::Base;
+};
+
+template <typename Base, bool Nothrow>
+struct MoveAssignLayer<Base, SpecialMember::NonTrivial, Nothrow> : Base {
+    using Base::Base;
+
+    MoveAssignLayer() = default;
+
+    MoveAssignLayer(const MoveAssignLayer &other) = default;
+
+    MoveAssignLayer(MoveAssignLayer &&other) = default;
+
+    MoveAssignLayer& operator=(const MoveAssignLayer &other) = default;
+
+    constexpr MoveAssignLayer& operator=(MoveAssignLayer &&other) noexcept(Nothrow) {
+        this->assign_from(std::move(other));
+
+        return *this;
+    }
+};
+
+template <typename Base, bool Nothrow>
+struct MoveAssignLayer<Base, SpecialMember::Deleted, Nothrow> : Base {
+    using Base::Base;
+
+    MoveAssignLayer() = default;
+
+    MoveAssignLayer(const MoveAssignLayer &other) = default;
+
+    MoveAssignLayer(MoveAssignLayer &&other) = default;
+
+    MoveAssignLayer& operator=(const MoveAssignLayer &other) = default;
+};
+
+template <typename Base, typename ...Ts>
+using SpecialMembers = MoveAssignLayer<
+    CopyAssignLayer<
+        MoveConstructLayer<
+            CopyConstructLayer<
+                Base,
+                copy_construct_kind<Ts...>::value,
+                all_of<std::is_nothrow_copy_constructible<Ts>::value...>::value
+            >,
+            move_construct_kind<Ts...>::value,
+            all_of<std::is_nothrow_move_constructible<Ts>::value...>::value
+        >,
+        copy_assign_kind<Ts...>::value,
+        all_of<(std::is_nothrow_copy_constructible<Ts>::value
+                && std::is_nothrow_copy_assignable<Ts>::value)...>::value
+    >,
+    move_assign_kind<Ts...>::value,
+    all_of<(std::is_nothrow_move_constructible<Ts>::value
+            && std::is_nothrow_move_assignable<Ts>::value)...>::value
+>;
+
+} // namespace detail
+} // namespace monads
+
+#endif
@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_STACK_TRACE_HPP
+#define MONADS_DETAIL_STACK_TRACE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__) && defined(__GNUC__) \
+    && (defined(__x86_64__) || defined(__aarch64__))
+#define MONADS_HAS_FRAME_POINTER_WALK
+#include <pthread.h>
+#endif
+
+namespace monads {
+namespace detail {
+
+struct StackBounds {
+    std::uintptr_t low;
+    std::uintptr_t high;
+};
+
+inline StackBounds current_stack_bounds() noexcept {
+    StackBounds bounds{ 0, 0 };
+
+#ifdef MONADS_HAS_FRAME_POINTER_WALK
+    pthread_attr_t attributes;
+
+    if (pthread_getattr_np(pthread_self(), &attributes) == 0) {
+        void *address = nullptr;
+        std::size_t size = 0;
+
+        if (pthread_attr_getstack(&attributes, &address, &size) == 0) {
+            bounds.low = reinterpret_cast<std::uintptr_t>(address);
+            bounds.high = bounds.low + size;
+        }
+
+        pthread_attr_destroy(&attributes);
+    }
+#endif
+
+    return bounds;
+}
+
+#if defined(__GNUC__)
+__attribute__((noinline))
+#endif
+inline std::size_t walk_frame_pointers(void **frames, std::size_t max_frames) noexcept {
+#ifdef MONADS_HAS_FRAME_POINTER_WALK
+    thread_local const StackBounds bounds = current_stack_bounds();
+
+    auto frame = reinterpret_cast<std::uintptr_t>(__builtin_frame_address(0));
+    std::size_t count = 0;
+
+    while (count < max_frames && frame >= bounds.low
+           && frame + 2 * sizeof(std::uintptr_t) <= bounds.high
+           && frame % alignof(std::uintptr_t) == 0) {
+        const auto *const record = reinterpret_cast<const std::uintptr_t*>(frame);
+        const std::uintptr_t next = record[0];
+        const std::uintptr_t return_address = record[1];
+
+        if (return_address == 0) {
+            break;
+        }
+
+        frames[count] = reinterpret_cast<void*>(return_address);
+        ++count;
+
+        if (next <= frame) {
+            break;
+        }
+
+        frame = next;
+    }
+
+    return count;
+#else
+    static_cast<void>(frames);
+    static_cast<void>(max_frames);
+
+    return 0;
+#endif
+}
+
+inline std::atomic<std::uint32_t>& trace_sample_rate() noexcept {
+    static std::atomic<std::uint32_t> rate{ 1 };
+
+    return rate;
+}
+
+inline bool should_sample_trace() noexcept {
+    const std::uint32_t rate = trace_sample_rate().load(std::memory_order_relaxed);
+
+    if (rate == 0) {
+        return false;
+    }
+
+    thread_local std::uint32_t seen = 0;
+
+    if (++seen < rate) {
+        return false;
+    }
+
+    seen = 0;
+
+    return true;
+}
+
+} // namespace detail
+} // namespace monads
+
+#endif
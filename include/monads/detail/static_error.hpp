@@ -0,0 +1,73 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_STATIC_ERROR_HPP
+#define MONADS_DETAIL_STATIC_ERROR_HPP
+
+#include <monads/detail/common.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+struct ErrorDescriptor {
+    const char *name;
+    int code;
+    const char *category;
+};
+
+namespace detail {
+
+template <typename Tag, typename = void>
+struct is_static_error_tag : std::false_type { };
+
+template <typename Tag>
+struct is_static_error_tag<Tag, void_t<
+    std::enable_if_t<std::is_convertible<decltype(Tag::name), const char*>::value>,
+    std::enable_if_t<std::is_convertible<decltype(Tag::code), int>::value>,
+    std::enable_if_t<std::is_convertible<decltype(Tag::category), const char*>::value>
+>> : std::true_type { };
+
+// a static data member of a class template has a single address in the
+// whole program, unlike a namespace scope constexpr variable in C++14
+template <typename Tag>
+struct StaticErrorRegistry {
+    static constexpr ErrorDescriptor descriptor = { Tag::name, Tag::code, Tag::category };
+};
+
+template <typename Tag>
+constexpr ErrorDescriptor StaticErrorRegistry<Tag>::descriptor;
+
+} // namespace detail
+} // namespace monads
+
+#endif
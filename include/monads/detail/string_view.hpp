@@ -0,0 +1,124 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_STRING_VIEW_HPP
+#define MONADS_DETAIL_STRING_VIEW_HPP
+
+#include <cstddef>
+#include <cstring>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<string_view>)
+#include <string_view>
+#define MONADS_HAS_STRING_VIEW
+#endif
+#endif
+
+namespace monads {
+namespace detail {
+
+#ifdef MONADS_HAS_STRING_VIEW
+using StringView = std::string_view;
+#else
+class StringView {
+public:
+    using size_type = std::size_t;
+
+    constexpr StringView() noexcept = default;
+
+    constexpr StringView(const char *data, size_type size) noexcept
+    : data_{ data }, size_{ size } { }
+
+    StringView(const char *str) noexcept : data_{ str }, size_{ std::strlen(str) } { }
+
+    constexpr const char* data() const noexcept {
+        return data_;
+    }
+
+    constexpr size_type size() const noexcept {
+        return size_;
+    }
+
+    constexpr bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    constexpr const char* begin() const noexcept {
+        return data_;
+    }
+
+    constexpr const char* end() const noexcept {
+        return data_ + size_;
+    }
+
+    constexpr char operator[](size_type index) const noexcept {
+        return data_[index];
+    }
+
+    constexpr char front() const noexcept {
+        return data_[0];
+    }
+
+    constexpr StringView substr(size_type position, size_type count) const noexcept {
+        return StringView{
+            data_ + position,
+            count < size_ - position ? count : size_ - position
+        };
+    }
+
+    constexpr StringView substr(size_type position) const noexcept {
+        return StringView{ data_ + position, size_ - position };
+    }
+
+    constexpr void remove_prefix(size_type count) noexcept {
+        data_ += count;
+        size_ -= count;
+    }
+
+private:
+    const char *data_ = nullptr;
+    size_type size_ = 0;
+};
+
+inline bool operator==(StringView lhs, StringView rhs) noexcept {
+    return lhs.size() == rhs.size()
+           && (lhs.size() == 0 || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+inline bool operator!=(StringView lhs, StringView rhs) noexcept {
+    return !(lhs == rhs);
+}
+#endif
+
+} // namespace detail
+} // namespace monads
+
+#endif
@@ -29,7 +29,11 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#ifndef MONADS_DETAIL_TRY_INVOKE_HPP
+#define MONADS_DETAIL_TRY_INVOKE_HPP
+
 #include <monads/detail/expected_impl.hpp>
+#include <monads/detail/instrumentation.hpp>
 #include <monads/detail/invoke.hpp>
 
 #include <monads/exception_ptr.hpp>
@@ -42,6 +46,12 @@
 namespace monads {
 namespace detail {
 
+template <typename R, typename E>
+using is_nothrow_try_invoke = all_of<
+	std::is_nothrow_constructible<R, R>::value,
+	std::is_nothrow_copy_constructible<E>::value
+>;
+
 template <typename E = std::exception_ptr>
 struct TryInvoker {
 	template <
@@ -59,9 +69,11 @@ struct TryInvoker {
 		try {
 			return Expected{
 				InPlaceValueType{ },
-				invoke(std::forward<C>(callable), std::forward<Ts>(ts)...)
+				detail::invoke(std::forward<C>(callable), std::forward<Ts>(ts)...)
 			};
 		} catch (const E &err) {
+			record_error<E>(site);
+
 			return Expected{ InPlaceErrorType{ }, err };
 		}
 	}
@@ -87,6 +99,8 @@ struct TryInvoker {
 			std::forward<Ts>(ts)...
 		);
 	}
+
+	ErrorSite site;
 };
 
 template <>
@@ -104,9 +118,11 @@ struct TryInvoker<std::exception_ptr> {
 		try {
 			return Expected{
 				InPlaceValueType{ },
-				invoke(std::forward<C>(callable), std::forward<Ts>(ts)...)
+				detail::invoke(std::forward<C>(callable), std::forward<Ts>(ts)...)
 			};
 		} catch (...) {
+			record_error<std::exception_ptr>(site);
+
 			return Expected{ InPlaceErrorType{ }, std::current_exception() };
 		}
 	}
@@ -132,6 +148,8 @@ struct TryInvoker<std::exception_ptr> {
 			std::forward<Ts>(ts)...
 		);
 	}
+
+	ErrorSite site;
 };
 
 template <typename E>
@@ -149,9 +167,11 @@ struct TryInvoker<ExceptionPtr<E>> {
 		try {
 			return Expected{
 				InPlaceValueType{ },
-				invoke(std::forward<C>(callable), std::forward<Ts>(ts)...)
+				detail::invoke(std::forward<C>(callable), std::forward<Ts>(ts)...)
 			};
 		} catch (const E &e) {
+			record_error<ExceptionPtr<E>>(site);
+
 			return Expected{
 				InPlaceErrorType{ },
 				current_exception<E>()
@@ -180,7 +200,11 @@ struct TryInvoker<ExceptionPtr<E>> {
 			std::forward<Ts>(ts)...
 		);
 	}
+
+	ErrorSite site;
 };
 
 } // namespace detail
 } // namespace monads
+
+#endif
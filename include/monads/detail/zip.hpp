@@ -0,0 +1,119 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_DETAIL_ZIP_HPP
+#define MONADS_DETAIL_ZIP_HPP
+
+#include <monads/expected.hpp>
+#include <monads/optional.hpp>
+
+#include <monads/detail/common.hpp>
+
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+namespace detail {
+
+template <typename T>
+struct is_optional : std::false_type { };
+
+template <typename T>
+struct is_optional<Optional<T>> : std::true_type { };
+
+template <typename T>
+struct is_expected : std::false_type { };
+
+template <typename T, typename E>
+struct is_expected<Expected<T, E>> : std::true_type { };
+
+template <typename T>
+struct expected_error { };
+
+template <typename T, typename E>
+struct expected_error<Expected<T, E>> {
+    using type = E;
+};
+
+template <typename T>
+using expected_error_t = typename expected_error<T>::type;
+
+template <typename ...Ms>
+using all_optionals = all_of<is_optional<std::decay_t<Ms>>::value...>;
+
+template <typename M, typename ...Ms>
+using all_expecteds_with_error = all_of<
+    is_expected<std::decay_t<M>>::value,
+    std::is_same<expected_error_t<std::decay_t<Ms>>,
+                 expected_error_t<std::decay_t<M>>>::value...
+>;
+
+template <typename M>
+using unwrapped_t = std::decay_t<decltype(std::declval<M>().unwrap())>;
+
+constexpr bool all_flags() noexcept {
+    return true;
+}
+
+template <typename ...Bs>
+constexpr bool all_flags(bool flag, Bs ...flags) noexcept {
+    return static_cast<bool>(flag & all_flags(flags...));
+}
+
+// the callable is never invoked, since expected holds no value
+template <typename T, typename M>
+Expected<T, expected_error_t<std::decay_t<M>>> propagate_failure(M &&expected) {
+    return std::forward<M>(expected).map([](auto&&) -> T { std::abort(); });
+}
+
+template <typename T, typename M>
+Expected<T, expected_error_t<std::decay_t<M>>> first_failure(M &&expected) {
+    return propagate_failure<T>(std::forward<M>(expected));
+}
+
+template <typename T, typename M, typename N, typename ...Ms>
+Expected<T, expected_error_t<std::decay_t<M>>> first_failure(
+    M &&expected,
+    N &&next,
+    Ms &&...rest
+) {
+    if (!expected.has_value()) {
+        return propagate_failure<T>(std::forward<M>(expected));
+    }
+
+    return first_failure<T>(std::forward<N>(next), std::forward<Ms>(rest)...);
+}
+
+} // namespace detail
+} // namespace monads
+
+#endif
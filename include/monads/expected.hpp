@@ -44,6 +44,11 @@
 #include <type_traits>
 #include <utility>
 
+#ifdef MONADS_EXTERN_TEMPLATES
+#include <string>
+#include <system_error>
+#endif
+
 namespace monads {
 
 template <
@@ -76,7 +81,7 @@ constexpr Expected<T, E> make_expected(
     std::initializer_list<U>&,
     Ts&&...
 >::value) {
-    return make_expected<T, E>(list, std::forward<Ts>(ts)...);
+    return Expected<T, E>{ InPlaceValueType{ }, list, std::forward<Ts>(ts)... };
 }
 
 template <
@@ -110,28 +115,129 @@ noexcept(std::is_nothrow_constructible<
     std::initializer_list<U>&,
     Ts&&...
 >::value) {
-    return make_unexpected<T, E>(list, std::forward<Ts>(ts)...);
+    return Expected<T, E>{ InPlaceErrorType{ }, list, std::forward<Ts>(ts)... };
+}
+
+// each call is recorded against the caller's site; with more than
+// MAX_SITED_ARGUMENTS arguments, use MONADS_TRY_INVOKE or try_invoke_at for that
+template <
+    typename E = std::exception_ptr,
+    typename C,
+    std::enable_if_t<detail::is_invocable<C&&>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&>, E> try_invoke(
+    C &&callable,
+    ErrorSite site = ErrorSite::current()
+) noexcept(detail::is_nothrow_try_invoke<detail::invoke_result_t<C&&>, E>::value) {
+    return detail::TryInvoker<E>{ site }(
+        std::forward<C>(callable)
+    );
+}
+
+template <
+    typename E = std::exception_ptr,
+    typename C,
+    typename A,
+    std::enable_if_t<detail::is_invocable<C&&, A&&>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&, A&&>, E> try_invoke(
+    C &&callable,
+    A &&a,
+    ErrorSite site = ErrorSite::current()
+) noexcept(detail::is_nothrow_try_invoke<detail::invoke_result_t<C&&, A&&>, E>::value) {
+    return detail::TryInvoker<E>{ site }(
+        std::forward<C>(callable),
+        std::forward<A>(a)
+    );
+}
+
+template <
+    typename E = std::exception_ptr,
+    typename C,
+    typename A,
+    typename B,
+    std::enable_if_t<detail::is_invocable<C&&, A&&, B&&>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&, A&&, B&&>, E> try_invoke(
+    C &&callable,
+    A &&a,
+    B &&b,
+    ErrorSite site = ErrorSite::current()
+) noexcept(detail::is_nothrow_try_invoke<detail::invoke_result_t<C&&, A&&, B&&>, E>::value) {
+    return detail::TryInvoker<E>{ site }(
+        std::forward<C>(callable),
+        std::forward<A>(a),
+        std::forward<B>(b)
+    );
+}
+
+template <
+    typename E = std::exception_ptr,
+    typename C,
+    typename A,
+    typename B,
+    typename D,
+    std::enable_if_t<detail::is_invocable<C&&, A&&, B&&, D&&>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&, A&&, B&&, D&&>, E> try_invoke(
+    C &&callable,
+    A &&a,
+    B &&b,
+    D &&d,
+    ErrorSite site = ErrorSite::current()
+) noexcept(detail::is_nothrow_try_invoke<detail::invoke_result_t<C&&, A&&, B&&, D&&>, E>::value) {
+    return detail::TryInvoker<E>{ site }(
+        std::forward<C>(callable),
+        std::forward<A>(a),
+        std::forward<B>(b),
+        std::forward<D>(d)
+    );
 }
 
 template <
     typename E = std::exception_ptr,
     typename C,
     typename ...As,
-    std::enable_if_t<detail::is_invocable<C&&, As&&...>::value, int> = 0
+    std::enable_if_t<
+        (sizeof...(As) > detail::MAX_SITED_ARGUMENTS)
+        && detail::is_invocable<C&&, As&&...>::value,
+        int
+    > = 0
 >
 Expected<detail::invoke_result_t<C&&, As&&...>, E> try_invoke(
     C &&callable,
     As &&...args
-) noexcept(std::is_nothrow_constructible<
-    detail::invoke_result_t<C&&, As&&...>,
-    detail::invoke_result_t<C&&, As&&...>
->::value && std::is_nothrow_copy_constructible<E>::value) {
-    return detail::TryInvoker<E>{ }(
+) noexcept(detail::is_nothrow_try_invoke<detail::invoke_result_t<C&&, As&&...>, E>::value) {
+    return detail::TryInvoker<E>{ ErrorSite::current() }(
         std::forward<C>(callable),
         std::forward<As>(args)...
     );
 }
 
+template <
+    typename E = std::exception_ptr,
+    typename C,
+    typename ...As,
+    std::enable_if_t<detail::is_invocable<C&&, As&&...>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&, As&&...>, E> try_invoke_at(
+    const ErrorSite &site,
+    C &&callable,
+    As &&...args
+) noexcept(detail::is_nothrow_try_invoke<detail::invoke_result_t<C&&, As&&...>, E>::value) {
+    return detail::TryInvoker<E>{ site }(
+        std::forward<C>(callable),
+        std::forward<As>(args)...
+    );
+}
+
+#define MONADS_TRY_INVOKE(...) \
+    ::monads::try_invoke_at(::monads::ErrorSite::current(), __VA_ARGS__)
+
+#ifdef MONADS_EXTERN_TEMPLATES
+extern template class Expected<std::string, std::error_code>;
+#endif
+
 } // namespace monads
 
 #endif
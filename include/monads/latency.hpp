@@ -0,0 +1,301 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_LATENCY_HPP
+#define MONADS_LATENCY_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/instrumentation.hpp>
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/latency.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+class LatencyHistogram {
+public:
+    static constexpr std::size_t BUCKETS = detail::LATENCY_BUCKETS;
+
+    void record(std::uint64_t nanoseconds, std::uint64_t count = 1) noexcept {
+        counts_[detail::latency_bucket(nanoseconds)] += count;
+        total_ += count;
+    }
+
+    void add(std::size_t bucket, std::uint64_t count) noexcept {
+        counts_[bucket] += count;
+        total_ += count;
+    }
+
+    void merge(const LatencyHistogram &other) noexcept {
+        for (std::size_t i = 0; i < BUCKETS; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+
+        total_ += other.total_;
+    }
+
+    std::uint64_t count() const noexcept {
+        return total_;
+    }
+
+    std::uint64_t bucket_count(std::size_t bucket) const noexcept {
+        return counts_[bucket];
+    }
+
+    static std::uint64_t bucket_floor(std::size_t bucket) noexcept {
+        return detail::latency_bucket_floor(bucket);
+    }
+
+    std::uint64_t percentile(double fraction) const noexcept {
+        if (total_ == 0) {
+            return 0;
+        }
+
+        const double target = fraction * static_cast<double>(total_);
+        std::uint64_t seen = 0;
+
+        for (std::size_t i = 0; i < BUCKETS; ++i) {
+            seen += counts_[i];
+
+            if (counts_[i] != 0 && static_cast<double>(seen) >= target) {
+                return i + 1 < BUCKETS ? bucket_floor(i + 1) - 1 : bucket_floor(i);
+            }
+        }
+
+        return bucket_floor(BUCKETS - 1);
+    }
+
+private:
+    std::uint64_t counts_[BUCKETS] = { };
+    std::uint64_t total_ = 0;
+};
+
+#ifdef MONADS_HAS_TSC_CLOCK
+// reads the time stamp counter and scales it to nanoseconds, which costs a few
+// nanoseconds where steady_clock costs tens; it assumes an invariant TSC and
+// calibrates against steady_clock for a millisecond on first use
+struct TscClock {
+    using rep = std::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<TscClock>;
+
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept {
+        const detail::TscCalibration &calibration = detail::tsc_calibration();
+        const auto ticks = static_cast<std::int64_t>(detail::read_tsc() - calibration.base);
+
+        return time_point{ duration{
+            static_cast<rep>(static_cast<double>(ticks) * calibration.nanoseconds_per_tick)
+        } };
+    }
+};
+
+using LatencyClock = TscClock;
+#else
+using LatencyClock = std::chrono::steady_clock;
+#endif
+
+struct LatencySnapshot {
+    LatencyHistogram successes;
+    LatencyHistogram failures;
+};
+
+template <typename Clock = LatencyClock>
+class LatencyRecorder {
+public:
+    explicit LatencyRecorder(std::size_t shards = 16) : counts_{ shards } { }
+
+    LatencyRecorder(const LatencyRecorder &other) = delete;
+
+    LatencyRecorder& operator=(const LatencyRecorder &other) = delete;
+
+    void record(bool success, std::uint64_t nanoseconds) noexcept {
+        counts_.record(success, nanoseconds);
+    }
+
+    LatencySnapshot snapshot() const {
+        LatencySnapshot snapshot;
+
+        counts_.for_each([&snapshot](bool success, std::size_t bucket, std::uint64_t count) {
+            (success ? snapshot.successes : snapshot.failures).add(bucket, count);
+        });
+
+        return snapshot;
+    }
+
+    template <typename E = std::exception_ptr, typename C, typename ...As>
+    Expected<detail::invoke_result_t<C&&, As&&...>, E> invoke(
+        const ErrorSite &site,
+        C &&callable,
+        As &&...args
+    ) {
+        const typename Clock::time_point start = Clock::now();
+
+        auto result = detail::TryInvoker<E>{ site }(
+            std::forward<C>(callable),
+            std::forward<As>(args)...
+        );
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - start
+        ).count();
+
+        record(result.has_value(), elapsed > 0 ? static_cast<std::uint64_t>(elapsed) : 0);
+
+        return result;
+    }
+
+private:
+    detail::ShardedLatencyCounts counts_;
+};
+
+// errors are recorded against the caller, as with try_invoke
+template <
+    typename E = std::exception_ptr,
+    typename Clock,
+    typename C,
+    std::enable_if_t<detail::is_invocable<C&&>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&>, E> timed_try_invoke(
+    LatencyRecorder<Clock> &recorder,
+    C &&callable,
+    ErrorSite site = ErrorSite::current()
+) {
+    return recorder.template invoke<E>(
+        site,
+        std::forward<C>(callable)
+    );
+}
+
+template <
+    typename E = std::exception_ptr,
+    typename Clock,
+    typename C,
+    typename A,
+    std::enable_if_t<detail::is_invocable<C&&, A&&>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&, A&&>, E> timed_try_invoke(
+    LatencyRecorder<Clock> &recorder,
+    C &&callable,
+    A &&a,
+    ErrorSite site = ErrorSite::current()
+) {
+    return recorder.template invoke<E>(
+        site,
+        std::forward<C>(callable),
+        std::forward<A>(a)
+    );
+}
+
+template <
+    typename E = std::exception_ptr,
+    typename Clock,
+    typename C,
+    typename A,
+    typename B,
+    std::enable_if_t<detail::is_invocable<C&&, A&&, B&&>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&, A&&, B&&>, E> timed_try_invoke(
+    LatencyRecorder<Clock> &recorder,
+    C &&callable,
+    A &&a,
+    B &&b,
+    ErrorSite site = ErrorSite::current()
+) {
+    return recorder.template invoke<E>(
+        site,
+        std::forward<C>(callable),
+        std::forward<A>(a),
+        std::forward<B>(b)
+    );
+}
+
+template <
+    typename E = std::exception_ptr,
+    typename Clock,
+    typename C,
+    typename A,
+    typename B,
+    typename D,
+    std::enable_if_t<detail::is_invocable<C&&, A&&, B&&, D&&>::value, int> = 0
+>
+Expected<detail::invoke_result_t<C&&, A&&, B&&, D&&>, E> timed_try_invoke(
+    LatencyRecorder<Clock> &recorder,
+    C &&callable,
+    A &&a,
+    B &&b,
+    D &&d,
+    ErrorSite site = ErrorSite::current()
+) {
+    return recorder.template invoke<E>(
+        site,
+        std::forward<C>(callable),
+        std::forward<A>(a),
+        std::forward<B>(b),
+        std::forward<D>(d)
+    );
+}
+
+template <
+    typename E = std::exception_ptr,
+    typename Clock,
+    typename C,
+    typename ...As,
+    std::enable_if_t<
+        (sizeof...(As) > detail::MAX_SITED_ARGUMENTS)
+        && detail::is_invocable<C&&, As&&...>::value,
+        int
+    > = 0
+>
+Expected<detail::invoke_result_t<C&&, As&&...>, E> timed_try_invoke(
+    LatencyRecorder<Clock> &recorder,
+    C &&callable,
+    As &&...args
+) {
+    return recorder.template invoke<E>(
+        ErrorSite::current(),
+        std::forward<C>(callable),
+        std::forward<As>(args)...
+    );
+}
+
+} // namespace monads
+
+#endif
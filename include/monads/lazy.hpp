@@ -0,0 +1,157 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_LAZY_HPP
+#define MONADS_LAZY_HPP
+
+#include <monads/expected.hpp>
+#include <monads/optional.hpp>
+
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/lazy.hpp>
+#include <monads/detail/optional.hpp>
+
+#include <exception>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+template <typename T>
+class LazyOptional {
+public:
+    constexpr LazyOptional() noexcept = default;
+
+    LazyOptional(const LazyOptional &other) = delete;
+
+    LazyOptional& operator=(const LazyOptional &other) = delete;
+
+    bool has_value() const noexcept {
+        return once_.is_ready();
+    }
+
+    explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    bool operator!() const noexcept {
+        return !has_value();
+    }
+
+    const T& operator*() const {
+        return unwrap();
+    }
+
+    const T* operator->() const {
+        return std::addressof(unwrap());
+    }
+
+    const T& value() const {
+        if (!has_value()) {
+            throw BadOptionalAccess{ };
+        }
+
+        return unwrap();
+    }
+
+    const T& unwrap() const noexcept {
+        return storage_.value;
+    }
+
+    template <
+        typename C,
+        std::enable_if_t<
+            detail::is_invocable<C&&>::value
+            && std::is_constructible<T, detail::invoke_result_t<C&&>>::value,
+            int
+        > = 0
+    >
+    const T& get_or_init(C &&callable) {
+        once_.call_once([this, &callable] {
+            storage_.construct(detail::ValueTag{ },
+                               detail::invoke(std::forward<C>(callable)));
+        });
+
+        return unwrap();
+    }
+
+private:
+    detail::OnceFlag once_;
+    detail::OptionalStorage<T> storage_;
+};
+
+template <typename T, typename E = std::exception_ptr>
+class LazyExpected {
+public:
+    constexpr LazyExpected() noexcept = default;
+
+    LazyExpected(const LazyExpected &other) = delete;
+
+    LazyExpected& operator=(const LazyExpected &other) = delete;
+
+    bool is_initialized() const noexcept {
+        return once_.is_ready();
+    }
+
+    const Expected<T, E>& unwrap() const noexcept {
+        return storage_.value;
+    }
+
+    template <
+        typename C,
+        std::enable_if_t<
+            detail::is_invocable<C&&>::value
+            && std::is_constructible<T, detail::invoke_result_t<C&&>>::value,
+            int
+        > = 0
+    >
+    const Expected<T, E>& get_or_init(C &&callable,
+                                      ErrorSite site = ErrorSite::current()) {
+        once_.call_once([this, &callable, &site] {
+            storage_.construct(
+                detail::ValueTag{ },
+                detail::TryInvoker<E>{ site }(std::forward<C>(callable))
+            );
+        });
+
+        return unwrap();
+    }
+
+private:
+    detail::OnceFlag once_;
+    detail::OptionalStorage<Expected<T, E>> storage_;
+};
+
+} // namespace monads
+
+#endif
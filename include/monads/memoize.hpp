@@ -0,0 +1,200 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_MEMOIZE_HPP
+#define MONADS_MEMOIZE_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/circuit_breaker.hpp>
+#include <monads/detail/memoize.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace monads {
+
+struct MemoizeOptions {
+    std::size_t shards = 16;
+    bool cache_errors = false;
+    std::chrono::nanoseconds ttl = std::chrono::nanoseconds::zero();
+};
+
+struct MemoizeStats {
+    std::size_t hits;
+    std::size_t misses;
+};
+
+template <
+    typename F,
+    typename E = std::exception_ptr,
+    typename Clock = std::chrono::steady_clock
+>
+class MemoizedInvoker {
+public:
+    using Key = typename detail::callable_traits<F>::key;
+
+    using Result = Expected<typename detail::memoized_result<F, Key>::type, E>;
+
+    // errors are recorded against site, the place the invoker was built
+    explicit MemoizedInvoker(F callable, MemoizeOptions options = { },
+                             ErrorSite site = ErrorSite::current())
+    : callable_(std::move(callable)), options_{ options }, site_{ site },
+      shards_(options.shards == 0 ? 1 : options.shards) { }
+
+    MemoizedInvoker(const MemoizedInvoker &other) = delete;
+
+    MemoizedInvoker(MemoizedInvoker &&other) = default;
+
+    MemoizedInvoker& operator=(const MemoizedInvoker &other) = delete;
+
+    MemoizedInvoker& operator=(MemoizedInvoker &&other) = default;
+
+    template <
+        typename ...As,
+        std::enable_if_t<std::is_constructible<Key, As&&...>::value, int> = 0
+    >
+    std::shared_ptr<const Result> operator()(As &&...args) {
+        Key key(std::forward<As>(args)...);
+        Shard &shard = shards_[detail::TupleHash<Key>{ }(key) % shards_.size()];
+
+        {
+            const std::lock_guard<std::mutex> guard{ shard.mutex };
+            const auto found = shard.entries.find(key);
+
+            if (found != shard.entries.end() && !is_expired(found->second)) {
+                ++shard.hits;
+
+                return found->second.result;
+            }
+
+            ++shard.misses;
+        }
+
+        auto result = std::make_shared<const Result>(detail::apply(
+            [this](const auto &...elems) {
+                return detail::TryInvoker<E>{ site_ }(
+                    static_cast<const F&>(callable_),
+                    elems...
+                );
+            },
+            key
+        ));
+
+        if (result->has_value() || options_.cache_errors) {
+            const std::lock_guard<std::mutex> guard{ shard.mutex };
+
+            shard.entries[std::move(key)] = Entry{ result, expiry() };
+        }
+
+        return result;
+    }
+
+    std::vector<MemoizeStats> stats() const {
+        std::vector<MemoizeStats> all;
+        all.reserve(shards_.size());
+
+        for (const Shard &shard : shards_) {
+            const std::lock_guard<std::mutex> guard{ shard.mutex };
+
+            all.push_back(MemoizeStats{ shard.hits, shard.misses });
+        }
+
+        return all;
+    }
+
+    void clear() {
+        for (Shard &shard : shards_) {
+            const std::lock_guard<std::mutex> guard{ shard.mutex };
+
+            shard.entries.clear();
+        }
+    }
+
+private:
+    struct Entry {
+        std::shared_ptr<const Result> result;
+        typename Clock::time_point expires;
+    };
+
+    // shards are locked independently, so keep each on its own cache line
+    struct alignas(detail::CACHE_LINE_SIZE) Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<Key, Entry, detail::TupleHash<Key>> entries;
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+    };
+
+    bool is_expired(const Entry &entry) const {
+        return options_.ttl != std::chrono::nanoseconds::zero()
+               && Clock::now() >= entry.expires;
+    }
+
+    typename Clock::time_point expiry() const {
+        if (options_.ttl == std::chrono::nanoseconds::zero()) {
+            return typename Clock::time_point{ };
+        }
+
+        return Clock::now()
+               + std::chrono::duration_cast<typename Clock::duration>(options_.ttl);
+    }
+
+    F callable_;
+    MemoizeOptions options_;
+    ErrorSite site_;
+    std::vector<Shard, detail::AlignedAllocator<Shard>> shards_;
+};
+
+template <
+    typename E = std::exception_ptr,
+    typename C
+>
+MemoizedInvoker<std::decay_t<C>, E> memoize(C &&callable,
+                                            MemoizeOptions options = { },
+                                            ErrorSite site = ErrorSite::current()) {
+    return MemoizedInvoker<std::decay_t<C>, E>{
+        std::forward<C>(callable),
+        options,
+        site
+    };
+}
+
+} // namespace monads
+
+#endif
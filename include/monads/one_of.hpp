@@ -0,0 +1,204 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_ONE_OF_HPP
+#define MONADS_ONE_OF_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/common.hpp>
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/one_of.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+template <typename ...Es>
+class OneOf : private detail::OneOfPayload<Es...> {
+public:
+    static_assert(sizeof...(Es) > 0, "OneOf must have at least one alternative");
+
+    static_assert(
+        sizeof...(Es) <= detail::ONE_OF_MAX_ALTERNATIVES,
+        "OneOf alternatives must fit in its one byte tag"
+    );
+
+    static_assert(
+        detail::all_of<(detail::one_of_count<Es, Es...>::value == 1)...>::value,
+        "OneOf alternatives must be distinct"
+    );
+
+    static_assert(
+        detail::all_of<std::is_same<Es, std::decay_t<Es>>::value...>::value,
+        "OneOf alternatives must be cv-unqualified object types"
+    );
+
+    static_assert(
+        detail::all_of<std::is_nothrow_move_constructible<Es>::value...>::value,
+        "OneOf alternatives must be nothrow move constructible"
+    );
+
+    template <typename ...Fs>
+    friend class OneOf;
+
+    // is_constructible is only checked once F is known to be an alternative;
+    // checking it for an Expected holding this OneOf recurses into Expected's
+    // constrained converting constructors
+    template <
+        typename F,
+        std::enable_if_t<detail::is_one_of_alternative<std::decay_t<F>, Es...>::value, int> = 0,
+        std::enable_if_t<std::is_constructible<std::decay_t<F>, F&&>::value, int> = 0
+    >
+    constexpr OneOf(F &&error) noexcept(std::is_nothrow_constructible<std::decay_t<F>, F&&>::value)
+    : Payload{
+        detail::IndexConstant<detail::one_of_index<std::decay_t<F>, Es...>::value>{ },
+        std::forward<F>(error)
+    } { }
+
+    template <typename ...Fs, std::enable_if_t<
+        !std::is_same<OneOf<Fs...>, OneOf>::value
+        && detail::all_of<detail::is_one_of_alternative<Fs, Es...>::value...>::value
+        && detail::all_of<std::is_copy_constructible<Fs>::value...>::value,
+        int
+    > = 0>
+    OneOf(const OneOf<Fs...> &other)
+    noexcept(detail::all_of<std::is_nothrow_copy_constructible<Fs>::value...>::value)
+    : Payload{ } {
+        other.visit([this](const auto &error) {
+            this->construct(detail::IndexConstant<detail::one_of_index<
+                std::decay_t<decltype(error)>,
+                Es...
+            >::value>{ }, error);
+        });
+    }
+
+    template <typename ...Fs, std::enable_if_t<
+        !std::is_same<OneOf<Fs...>, OneOf>::value
+        && detail::all_of<detail::is_one_of_alternative<Fs, Es...>::value...>::value,
+        int
+    > = 0>
+    OneOf(OneOf<Fs...> &&other) noexcept : Payload{ } {
+        std::move(other).visit([this](auto &&error) {
+            this->construct(detail::IndexConstant<detail::one_of_index<
+                std::decay_t<decltype(error)>,
+                Es...
+            >::value>{ }, std::move(error));
+        });
+    }
+
+    constexpr std::size_t index() const noexcept {
+        return Payload::index();
+    }
+
+    template <typename F>
+    constexpr bool holds() const noexcept {
+        static_assert(detail::is_one_of_alternative<F, Es...>::value,
+                      "F must be an alternative of this OneOf");
+
+        return index() == detail::one_of_index<F, Es...>::value;
+    }
+
+    template <typename F>
+    constexpr F& unwrap() & noexcept {
+        return this->get(index_of<F>());
+    }
+
+    template <typename F>
+    constexpr const F& unwrap() const & noexcept {
+        return this->get(index_of<F>());
+    }
+
+    template <typename F>
+    constexpr F&& unwrap() && noexcept {
+        return std::move(this->get(index_of<F>()));
+    }
+
+    template <typename F>
+    constexpr const F&& unwrap() const && noexcept {
+        return std::move(this->get(index_of<F>()));
+    }
+
+    // exhaustive: callable must accept every alternative, and the result is
+    // their common type
+    template <typename C>
+    decltype(auto) visit(C &&callable) & {
+        static_assert(detail::all_of<detail::is_invocable<C&&, Es&>::value...>::value,
+                      "visitor must accept every alternative of the OneOf");
+
+        using R = std::common_type_t<detail::invoke_result_t<C&&, Es&>...>;
+
+        return detail::one_of_dispatch<R, 0, sizeof...(Es)>(index(), [this, &callable](auto i) -> R {
+            return detail::invoke(std::forward<C>(callable), this->get(i));
+        });
+    }
+
+    template <typename C>
+    decltype(auto) visit(C &&callable) const & {
+        static_assert(detail::all_of<detail::is_invocable<C&&, const Es&>::value...>::value,
+                      "visitor must accept every alternative of the OneOf");
+
+        using R = std::common_type_t<detail::invoke_result_t<C&&, const Es&>...>;
+
+        return detail::one_of_dispatch<R, 0, sizeof...(Es)>(index(), [this, &callable](auto i) -> R {
+            return detail::invoke(std::forward<C>(callable), this->get(i));
+        });
+    }
+
+    template <typename C>
+    decltype(auto) visit(C &&callable) && {
+        static_assert(detail::all_of<detail::is_invocable<C&&, Es&&>::value...>::value,
+                      "visitor must accept every alternative of the OneOf");
+
+        using R = std::common_type_t<detail::invoke_result_t<C&&, Es&&>...>;
+
+        return detail::one_of_dispatch<R, 0, sizeof...(Es)>(index(), [this, &callable](auto i) -> R {
+            return detail::invoke(std::forward<C>(callable), std::move(this->get(i)));
+        });
+    }
+
+private:
+    using Payload = detail::OneOfPayload<Es...>;
+
+    template <typename F>
+    static constexpr detail::IndexConstant<detail::one_of_index<F, Es...>::value> index_of() noexcept {
+        static_assert(detail::is_one_of_alternative<F, Es...>::value,
+                      "F must be an alternative of this OneOf");
+
+        return { };
+    }
+};
+
+} // namespace monads
+
+#endif
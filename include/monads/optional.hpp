@@ -33,9 +33,11 @@
 #define MONADS_OPTIONAL_HPP
 
 #include <monads/detail/common.hpp>
+#include <monads/detail/instrumentation.hpp>
 #include <monads/detail/invoke.hpp>
 #include <monads/detail/optional.hpp>
 
+#include <cstdint>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -113,22 +115,31 @@ public:
     >::value)
     : storage_(detail::ValueTag{ }, list, std::forward<Ts>(ts)...) { }
 
-    template <std::enable_if_t<std::is_copy_constructible<T>::value, int> = 0>
-    Optional(const Optional &other)
-    noexcept(std::is_nothrow_copy_constructible<T>::value) {
+#ifdef MONADS_HAS_CONCEPTS
+    template <typename U>
+    requires std::is_constructible_v<T, const U&>
+    constexpr explicit(!std::is_convertible_v<const U&, T>) Optional(const Optional<U> &other)
+    noexcept(std::is_nothrow_constructible<T, const U&>::value) {
         if (other.has_value()) {
             construct(other.unwrap());
         }
     }
 
-    template <std::enable_if_t<std::is_move_constructible<T>::value, int> = 0>
-    Optional(Optional &&other)
-    noexcept(std::is_nothrow_move_constructible<T>::value) {
+    template <typename U>
+    requires std::is_constructible_v<T, U&&>
+    constexpr explicit(!std::is_convertible_v<U&&, T>) Optional(Optional<U> &&other)
+    noexcept(std::is_nothrow_constructible<T, U&&>::value) {
         if (other.has_value()) {
             construct(std::move(other).unwrap());
         }
     }
 
+    template <typename U>
+    requires std::is_constructible_v<T, U&&>
+    constexpr explicit(!std::is_convertible_v<U&&, T>) Optional(U &&u)
+    noexcept(std::is_nothrow_constructible<T, U&&>::value)
+    : storage_{ detail::ValueTag{ }, std::forward<U>(u) } { }
+#else
     template <
         typename U,
         std::enable_if_t<
@@ -137,7 +148,7 @@ public:
             int
         > = 0
     >
-    Optional(const Optional<U> &other)
+    constexpr Optional(const Optional<U> &other)
     noexcept(std::is_nothrow_constructible<T, const U&>::value) {
         if (other.has_value()) {
             construct(other.unwrap());
@@ -152,7 +163,7 @@ public:
             int
         > = 0
     >
-    explicit Optional(const Optional<U> &other)
+    constexpr explicit Optional(const Optional<U> &other)
     noexcept(std::is_nothrow_constructible<T, const U&>::value) {
         if (other.has_value()) {
             construct(other.unwrap());
@@ -167,7 +178,7 @@ public:
             int
         > = 0
     >
-    Optional(Optional<U> &&other)
+    constexpr Optional(Optional<U> &&other)
     noexcept(std::is_nothrow_constructible<T, U&&>::value) {
         if (other.has_value()) {
             construct(std::move(other).unwrap());
@@ -182,7 +193,7 @@ public:
             int
         > = 0
     >
-    explicit Optional(Optional<U> &&other)
+    constexpr explicit Optional(Optional<U> &&other)
     noexcept(std::is_nothrow_constructible<T, U&&>::value) {
         if (other.has_value()) {
             construct(std::move(other).unwrap());
@@ -206,26 +217,7 @@ public:
     constexpr explicit Optional(U &&u)
     noexcept(std::is_nothrow_constructible<T, U&&>::value)
     : storage_{ detail::ValueTag{ }, std::forward<U>(u) } { }
-
-    template <std::enable_if_t<
-        std::is_copy_constructible<T>::value &&
-        std::is_copy_assignable<T>::value,
-        int
-    > = 0>
-    Optional& operator=(const Optional &other) noexcept(
-        std::is_nothrow_copy_constructible<T>::value
-        && std::is_nothrow_copy_assignable<T>::value
-    ) {
-        if (other.has_value()) {
-            if (has_value()) {
-                unwrap() = other.unwrap();
-            } else {
-                construct(other.unwrap());
-            }
-        } else {
-            reset();
-        }
-    }
+#endif
 
     constexpr bool has_value() const noexcept {
         return storage_.has_value;
@@ -248,11 +240,11 @@ public:
     }
 
     constexpr T&& operator*() && {
-        return unwrap();
+        return std::move(*this).unwrap();
     }
 
     constexpr const T&& operator*() const && {
-        return unwrap();
+        return std::move(*this).unwrap();
     }
 
     constexpr T* operator->() {
@@ -284,7 +276,7 @@ public:
             throw BadOptionalAccess{ };
         }
 
-        return unwrap();
+        return std::move(*this).unwrap();
     }
 
     constexpr const T&& value() const && {
@@ -292,7 +284,7 @@ public:
             throw BadOptionalAccess{ };
         }
 
-        return unwrap();
+        return std::move(*this).unwrap();
     }
 
     constexpr T& unwrap() & {
@@ -315,7 +307,7 @@ public:
         typename ...Ts,
         std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0
     >
-    T& emplace(Ts &&...ts)
+    constexpr T& emplace(Ts &&...ts)
     noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
         storage_.reset();
 
@@ -330,18 +322,24 @@ public:
             int
         > = 0
     >
-    T& emplace(std::initializer_list<U> list, Ts &&...ts)
+    constexpr T& emplace(std::initializer_list<U> list, Ts &&...ts)
     noexcept(std::is_nothrow_constructible<
         T,
         std::initializer_list<U>&, Ts&&...
     >::value) {
-        return emplace(list, std::forward<Ts>(ts)...);
+        storage_.reset();
+
+        return construct(list, std::forward<Ts>(ts)...);
     }
 
-    void reset() {
+    constexpr void reset() noexcept {
         storage_.reset();
     }
 
+#ifdef MONADS_HAS_CONCEPTS
+    template <typename C>
+    requires detail::invocable<C&&, const T&>
+#else
     template <
         typename C,
         std::enable_if_t<
@@ -349,6 +347,7 @@ public:
             int
         > = 0
     >
+#endif
     constexpr Optional<detail::invoke_result_t<C&&, const T&>>
     map(C &&callable) const & noexcept(
         detail::is_nothrow_invocable<C&&, const T&>::value
@@ -364,6 +363,10 @@ public:
         return make_optional<U>(std::forward<decltype(result)>(result));
     }
 
+#ifdef MONADS_HAS_CONCEPTS
+    template <typename C>
+    requires detail::invocable<C&&, T&&>
+#else
     template <
         typename C,
         std::enable_if_t<
@@ -371,6 +374,7 @@ public:
             int
         > = 0
     >
+#endif
     constexpr Optional<detail::invoke_result_t<C&&, T&&>>
     map(C &&callable) && noexcept(
         detail::is_nothrow_invocable<C&&, T&&>::value
@@ -392,39 +396,12 @@ private:
         typename ...Ts,
         std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0
     >
-    T& construct(Ts &&...args)
+    constexpr T& construct(Ts &&...args)
     noexcept(std::is_nothrow_constructible<T, Ts&&...>::value) {
-        try {
-            ::new(std::addressof(storage_.value)) T(std::forward<Ts>(args)...);
-            storage_.has_value = true;
-
-            return storage_.value;
-        } catch (...) {
-            storage_.has_value = false;
-
-            throw;
-        }
-    }
-
-    template <
-        typename U,
-        typename ...Ts,
-        std::enable_if_t<std::is_constructible<
-            T,
-            std::initializer_list<U>&,
-            Ts&&...
-        >::value, int> = 0
-    >
-    T& construct(std::initializer_list<U> list, Ts &&...args)
-    noexcept(std::is_nothrow_constructible<
-        T,
-        std::initializer_list<U>&,
-        Ts&&...
-    >::value) {
-        return construct(list, std::forward<Ts>(args)...);
+        return storage_.construct(detail::ValueTag{ }, std::forward<Ts>(args)...);
     }
 
-    detail::OptionalStorage<T> storage_;
+    detail::OptionalPayload<T> storage_;
 };
 
 template <typename T, typename ...Ts,
@@ -449,7 +426,7 @@ noexcept(std::is_nothrow_constructible<
     std::initializer_list<U>&,
     Ts&&...
 >::value) {
-    return make_optional<T>(list, std::forward<Ts>(ts)...);
+    return Optional<T>{ InPlaceType{ }, list, std::forward<Ts>(ts)... };
 }
 
 template <
@@ -457,7 +434,8 @@ template <
     typename ...As,
     std::enable_if_t<detail::is_invocable<C&&, As&&...>::value, int> = 0
 >
-Optional<detail::invoke_result_t<C&&, As&&...>> maybe_invoke(
+Optional<detail::invoke_result_t<C&&, As&&...>> maybe_invoke_at(
+    const ErrorSite &site,
     C &&callable,
     As &&...args
 ) noexcept {
@@ -470,11 +448,95 @@ Optional<detail::invoke_result_t<C&&, As&&...>> maybe_invoke(
             std::forward<C>(callable),
             std::forward<As>(args)...
         ));
-    } catch (...) { }
+    } catch (...) {
+        detail::record_error<void>(site);
+    }
 
     return maybe_result;
 }
 
+// each call is recorded against the caller's site; with more than
+// MAX_SITED_ARGUMENTS arguments, use MONADS_MAYBE_INVOKE or maybe_invoke_at for that
+template <
+    typename C,
+    std::enable_if_t<detail::is_invocable<C&&>::value, int> = 0
+>
+Optional<detail::invoke_result_t<C&&>> maybe_invoke(
+    C &&callable,
+    ErrorSite site = ErrorSite::current()
+) noexcept {
+    return maybe_invoke_at(site, std::forward<C>(callable));
+}
+
+template <
+    typename C,
+    typename A,
+    std::enable_if_t<detail::is_invocable<C&&, A&&>::value, int> = 0
+>
+Optional<detail::invoke_result_t<C&&, A&&>> maybe_invoke(
+    C &&callable,
+    A &&a,
+    ErrorSite site = ErrorSite::current()
+) noexcept {
+    return maybe_invoke_at(site, std::forward<C>(callable), std::forward<A>(a));
+}
+
+template <
+    typename C,
+    typename A,
+    typename B,
+    std::enable_if_t<detail::is_invocable<C&&, A&&, B&&>::value, int> = 0
+>
+Optional<detail::invoke_result_t<C&&, A&&, B&&>> maybe_invoke(
+    C &&callable,
+    A &&a,
+    B &&b,
+    ErrorSite site = ErrorSite::current()
+) noexcept {
+    return maybe_invoke_at(site, std::forward<C>(callable), std::forward<A>(a), std::forward<B>(b));
+}
+
+template <
+    typename C,
+    typename A,
+    typename B,
+    typename D,
+    std::enable_if_t<detail::is_invocable<C&&, A&&, B&&, D&&>::value, int> = 0
+>
+Optional<detail::invoke_result_t<C&&, A&&, B&&, D&&>> maybe_invoke(
+    C &&callable,
+    A &&a,
+    B &&b,
+    D &&d,
+    ErrorSite site = ErrorSite::current()
+) noexcept {
+    return maybe_invoke_at(site, std::forward<C>(callable), std::forward<A>(a), std::forward<B>(b), std::forward<D>(d));
+}
+
+template <
+    typename C,
+    typename ...As,
+    std::enable_if_t<
+        (sizeof...(As) > detail::MAX_SITED_ARGUMENTS)
+        && detail::is_invocable<C&&, As&&...>::value,
+        int
+    > = 0
+>
+Optional<detail::invoke_result_t<C&&, As&&...>> maybe_invoke(
+    C &&callable,
+    As &&...args
+) noexcept {
+    return maybe_invoke_at(ErrorSite::current(), std::forward<C>(callable),
+                           std::forward<As>(args)...);
+}
+
+#define MONADS_MAYBE_INVOKE(...) \
+    ::monads::maybe_invoke_at(::monads::ErrorSite::current(), __VA_ARGS__)
+
+#ifdef MONADS_EXTERN_TEMPLATES
+extern template class Optional<std::int64_t>;
+#endif
+
 } // namespace monads
 
 #endif
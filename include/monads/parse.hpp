@@ -0,0 +1,324 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_PARSE_HPP
+#define MONADS_PARSE_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/string_view.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+using StringView = detail::StringView;
+
+struct ParseError {
+    const char *position;
+    const char *expected;
+};
+
+template <typename T>
+using ParseResult = Expected<std::pair<T, StringView>, ParseError>;
+
+namespace detail {
+
+template <typename P>
+using parse_result_t = invoke_result_t<const P&, StringView>;
+
+template <typename P>
+using parsed_t = std::decay_t<decltype(std::declval<parse_result_t<P>&>().unwrap().first)>;
+
+template <typename T, typename U>
+ParseResult<T> parse_success(U &&value, StringView rest) {
+    return ParseResult<T>{ InPlaceValueType{ }, std::forward<U>(value), rest };
+}
+
+template <typename T>
+ParseResult<T> parse_failure(ParseError error) noexcept {
+    return ParseResult<T>{ InPlaceErrorType{ }, error };
+}
+
+template <typename T>
+ParseResult<T> parse_failure(const char *position, const char *expected) noexcept {
+    return ParseResult<T>{ InPlaceErrorType{ }, ParseError{ position, expected } };
+}
+
+inline bool is_digit(char c) noexcept {
+    return c >= '0' && c <= '9';
+}
+
+} // namespace detail
+
+namespace parse {
+
+template <typename P>
+auto satisfy(P predicate, const char *expected) {
+    return [predicate, expected](StringView input) -> ParseResult<char> {
+        if (input.empty() || !detail::invoke(predicate, input.front())) {
+            return detail::parse_failure<char>(input.data(), expected);
+        }
+
+        return detail::parse_success<char>(input.front(), input.substr(1));
+    };
+}
+
+inline auto character(char expected_char, const char *expected = "character") {
+    return satisfy([expected_char](char c) { return c == expected_char; }, expected);
+}
+
+inline auto literal(StringView text, const char *expected = "literal") {
+    return [text, expected](StringView input) -> ParseResult<StringView> {
+        if (input.substr(0, text.size()) != text) {
+            return detail::parse_failure<StringView>(input.data(), expected);
+        }
+
+        return detail::parse_success<StringView>(input.substr(0, text.size()),
+                                                 input.substr(text.size()));
+    };
+}
+
+template <typename P>
+auto take_while(P predicate) {
+    return [predicate](StringView input) -> ParseResult<StringView> {
+        std::size_t length = 0;
+
+        while (length < input.size() && detail::invoke(predicate, input[length])) {
+            ++length;
+        }
+
+        return detail::parse_success<StringView>(input.substr(0, length),
+                                                 input.substr(length));
+    };
+}
+
+template <typename P>
+auto take_while1(P predicate, const char *expected) {
+    return [predicate, expected](StringView input) -> ParseResult<StringView> {
+        std::size_t length = 0;
+
+        while (length < input.size() && detail::invoke(predicate, input[length])) {
+            ++length;
+        }
+
+        if (length == 0) {
+            return detail::parse_failure<StringView>(input.data(), expected);
+        }
+
+        return detail::parse_success<StringView>(input.substr(0, length),
+                                                 input.substr(length));
+    };
+}
+
+template <typename T>
+auto unsigned_integer(const char *expected = "unsigned integer") {
+    static_assert(std::is_unsigned<T>::value, "unsigned_integer requires an unsigned type");
+
+    return [expected](StringView input) -> ParseResult<T> {
+        constexpr T max = std::numeric_limits<T>::max();
+        std::size_t length = 0;
+        T value = 0;
+
+        for (; length < input.size() && detail::is_digit(input[length]); ++length) {
+            const T digit = static_cast<T>(input[length] - '0');
+
+            if (value > max / 10 || (value == max / 10 && digit > max % 10)) {
+                return detail::parse_failure<T>(input.data(), expected);
+            }
+
+            value = static_cast<T>(value * 10 + digit);
+        }
+
+        if (length == 0) {
+            return detail::parse_failure<T>(input.data(), expected);
+        }
+
+        return detail::parse_success<T>(value, input.substr(length));
+    };
+}
+
+template <typename P, typename C>
+auto map(P parser, C callable) {
+    using T = detail::parsed_t<P>;
+    using U = std::decay_t<detail::invoke_result_t<const C&, T&&>>;
+
+    return [parser, callable](StringView input) -> ParseResult<U> {
+        auto result = parser(input);
+
+        if (!result.has_value()) {
+            return detail::parse_failure<U>(result.unwrap_error());
+        }
+
+        auto &&parsed = std::move(result).unwrap();
+
+        return detail::parse_success<U>(
+            detail::invoke(callable, std::move(parsed.first)),
+            parsed.second
+        );
+    };
+}
+
+template <typename P>
+auto sequence(P parser) {
+    using T = std::tuple<detail::parsed_t<P>>;
+
+    return [parser](StringView input) -> ParseResult<T> {
+        auto result = parser(input);
+
+        if (!result.has_value()) {
+            return detail::parse_failure<T>(result.unwrap_error());
+        }
+
+        auto &&parsed = std::move(result).unwrap();
+
+        return detail::parse_success<T>(T{ std::move(parsed.first) }, parsed.second);
+    };
+}
+
+template <typename P, typename Q, typename ...Ps>
+auto sequence(P parser, Q next, Ps ...parsers) {
+    auto tail = sequence(std::move(next), std::move(parsers)...);
+
+    using Head = std::tuple<detail::parsed_t<P>>;
+    using Tail = detail::parsed_t<decltype(tail)>;
+    using T = decltype(std::tuple_cat(std::declval<Head>(), std::declval<Tail>()));
+
+    return [parser, tail](StringView input) -> ParseResult<T> {
+        auto head_result = parser(input);
+
+        if (!head_result.has_value()) {
+            return detail::parse_failure<T>(head_result.unwrap_error());
+        }
+
+        auto &&head = std::move(head_result).unwrap();
+        auto tail_result = tail(head.second);
+
+        if (!tail_result.has_value()) {
+            return detail::parse_failure<T>(tail_result.unwrap_error());
+        }
+
+        auto &&rest = std::move(tail_result).unwrap();
+
+        return detail::parse_success<T>(
+            std::tuple_cat(Head{ std::move(head.first) }, std::move(rest.first)),
+            rest.second
+        );
+    };
+}
+
+template <typename P>
+P alternative(P parser) {
+    return parser;
+}
+
+template <typename P, typename Q, typename ...Ps>
+auto alternative(P parser, Q next, Ps ...parsers) {
+    auto others = alternative(std::move(next), std::move(parsers)...);
+
+    using T = detail::parsed_t<P>;
+
+    static_assert(std::is_same<T, detail::parsed_t<decltype(others)>>::value,
+                  "every alternative must produce the same type");
+
+    return [parser, others](StringView input) -> ParseResult<T> {
+        auto result = parser(input);
+
+        if (result.has_value()) {
+            return result;
+        }
+
+        auto other = others(input);
+
+        if (other.has_value()
+            || other.unwrap_error().position >= result.unwrap_error().position) {
+            return other;
+        }
+
+        return result;
+    };
+}
+
+template <typename P>
+auto many(P parser) {
+    return [parser](StringView input) -> ParseResult<StringView> {
+        StringView rest = input;
+
+        while (true) {
+            auto result = parser(rest);
+
+            if (!result.has_value() || result.unwrap().second.data() == rest.data()) {
+                break;
+            }
+
+            rest = result.unwrap().second;
+        }
+
+        return detail::parse_success<StringView>(
+            input.substr(0, static_cast<std::size_t>(rest.data() - input.data())),
+            rest
+        );
+    };
+}
+
+template <typename P, typename T, typename C>
+auto fold_many(P parser, T init, C callable) {
+    return [parser, init, callable](StringView input) -> ParseResult<T> {
+        T accumulated = init;
+        StringView rest = input;
+
+        while (true) {
+            auto result = parser(rest);
+
+            if (!result.has_value() || result.unwrap().second.data() == rest.data()) {
+                break;
+            }
+
+            auto &&parsed = std::move(result).unwrap();
+
+            accumulated = detail::invoke(callable, std::move(accumulated),
+                                         std::move(parsed.first));
+            rest = parsed.second;
+        }
+
+        return detail::parse_success<T>(std::move(accumulated), rest);
+    };
+}
+
+} // namespace parse
+} // namespace monads
+
+#endif
@@ -0,0 +1,282 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_RANGES_HPP
+#define MONADS_RANGES_HPP
+
+#include <monads/optional.hpp>
+
+#include <monads/detail/ranges.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+namespace detail {
+
+template <typename F>
+class Box {
+public:
+    Box() = default;
+
+    explicit Box(F callable) : callable_{ InPlaceType{ }, std::move(callable) } { }
+
+    Box(const Box &other) = default;
+
+    Box(Box &&other) = default;
+
+    Box& operator=(const Box &other) {
+        if (this != &other) {
+            callable_.reset();
+            callable_.emplace(*other.callable_);
+        }
+
+        return *this;
+    }
+
+    Box& operator=(Box &&other) noexcept(std::is_nothrow_move_constructible<F>::value) {
+        if (this != &other) {
+            callable_.reset();
+            callable_.emplace(std::move(*other.callable_));
+        }
+
+        return *this;
+    }
+
+    const F& get() const noexcept {
+        return *callable_;
+    }
+
+private:
+    Optional<F> callable_;
+};
+
+template <typename R, typename Policy>
+class FilterView : public ViewBase {
+public:
+    FilterView() = default;
+
+    explicit FilterView(R &&range) : range_{ std::forward<R>(range) } { }
+
+    auto begin() {
+        return make_iterator(range_.get(), std::begin(range_.get()));
+    }
+
+    auto begin() const {
+        return make_iterator(range_.get(), std::begin(range_.get()));
+    }
+
+    auto end() {
+        return make_iterator(range_.get(), std::end(range_.get()));
+    }
+
+    auto end() const {
+        return make_iterator(range_.get(), std::end(range_.get()));
+    }
+
+private:
+    template <typename B, typename I>
+    static FilterIterator<I, Policy> make_iterator(B &base, I current) {
+        return FilterIterator<I, Policy>{ std::move(current), std::end(base) };
+    }
+
+    RangeRef<R> range_;
+};
+
+template <typename R, typename F>
+class FilterMapView : public ViewBase {
+public:
+    FilterMapView() = default;
+
+    FilterMapView(R &&range, F callable)
+    : range_{ std::forward<R>(range) }, callable_{ std::move(callable) } { }
+
+    auto begin() {
+        return make_iterator(range_.get(), std::begin(range_.get()));
+    }
+
+    auto begin() const {
+        return make_iterator(range_.get(), std::begin(range_.get()));
+    }
+
+    auto end() {
+        return make_iterator(range_.get(), std::end(range_.get()));
+    }
+
+    auto end() const {
+        return make_iterator(range_.get(), std::end(range_.get()));
+    }
+
+private:
+    template <typename B, typename I>
+    FilterMapIterator<I, F> make_iterator(B &base, I current) const {
+        return FilterMapIterator<I, F>{ std::move(current), std::end(base), callable_.get() };
+    }
+
+    RangeRef<R> range_;
+    Box<F> callable_;
+};
+
+template <typename R, typename F>
+class TransformExpectedView : public ViewBase {
+public:
+    TransformExpectedView() = default;
+
+    TransformExpectedView(R &&range, F callable)
+    : range_{ std::forward<R>(range) }, callable_{ std::move(callable) } { }
+
+    auto begin() {
+        return make_iterator(std::begin(range_.get()));
+    }
+
+    auto begin() const {
+        return make_iterator(std::begin(range_.get()));
+    }
+
+    auto end() {
+        return make_iterator(std::end(range_.get()));
+    }
+
+    auto end() const {
+        return make_iterator(std::end(range_.get()));
+    }
+
+    template <typename B = R>
+    auto size() const -> decltype(std::declval<const B&>().size()) {
+        return range_.get().size();
+    }
+
+private:
+    template <typename I>
+    TransformIterator<I, F> make_iterator(I current) const {
+        return TransformIterator<I, F>{ std::move(current), callable_.get() };
+    }
+
+    RangeRef<R> range_;
+    Box<F> callable_;
+};
+
+struct ValuesAdaptor { };
+
+struct ErrorsAdaptor { };
+
+template <typename F>
+struct FilterMapAdaptor {
+    F callable;
+};
+
+template <typename F>
+struct TransformExpectedAdaptor {
+    F callable;
+};
+
+} // namespace detail
+
+template <typename R>
+using ValuesView = detail::FilterView<R, detail::ValuesPolicy>;
+
+template <typename R>
+using ErrorsView = detail::FilterView<R, detail::ErrorsPolicy>;
+
+template <typename R, typename F>
+using FilterMapView = detail::FilterMapView<R, F>;
+
+template <typename R, typename F>
+using TransformExpectedView = detail::TransformExpectedView<R, F>;
+
+template <typename R>
+ValuesView<R> values(R &&range) {
+    return ValuesView<R>{ std::forward<R>(range) };
+}
+
+constexpr detail::ValuesAdaptor values() noexcept {
+    return { };
+}
+
+template <typename R>
+ErrorsView<R> errors(R &&range) {
+    return ErrorsView<R>{ std::forward<R>(range) };
+}
+
+constexpr detail::ErrorsAdaptor errors() noexcept {
+    return { };
+}
+
+template <typename R, typename F>
+FilterMapView<R, std::decay_t<F>> filter_map(R &&range, F &&callable) {
+    return FilterMapView<R, std::decay_t<F>>{ std::forward<R>(range), std::forward<F>(callable) };
+}
+
+template <typename F>
+detail::FilterMapAdaptor<std::decay_t<F>> filter_map(F &&callable) {
+    return { std::forward<F>(callable) };
+}
+
+template <typename R, typename F>
+TransformExpectedView<R, std::decay_t<F>> transform_expected(R &&range, F &&callable) {
+    return TransformExpectedView<R, std::decay_t<F>>{
+        std::forward<R>(range),
+        std::forward<F>(callable)
+    };
+}
+
+template <typename F>
+detail::TransformExpectedAdaptor<std::decay_t<F>> transform_expected(F &&callable) {
+    return { std::forward<F>(callable) };
+}
+
+namespace detail {
+
+template <typename R>
+ValuesView<R> operator|(R &&range, ValuesAdaptor) {
+    return ValuesView<R>{ std::forward<R>(range) };
+}
+
+template <typename R>
+ErrorsView<R> operator|(R &&range, ErrorsAdaptor) {
+    return ErrorsView<R>{ std::forward<R>(range) };
+}
+
+template <typename R, typename F>
+FilterMapView<R, F> operator|(R &&range, FilterMapAdaptor<F> adaptor) {
+    return FilterMapView<R, F>{ std::forward<R>(range), std::move(adaptor.callable) };
+}
+
+template <typename R, typename F>
+TransformExpectedView<R, F> operator|(R &&range, TransformExpectedAdaptor<F> adaptor) {
+    return TransformExpectedView<R, F>{ std::forward<R>(range), std::move(adaptor.callable) };
+}
+
+} // namespace detail
+} // namespace monads
+
+#endif
@@ -0,0 +1,314 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_RETRY_HPP
+#define MONADS_RETRY_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/retry.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace monads {
+
+template <typename E>
+struct RetryPolicy {
+    std::size_t max_attempts = 3;
+    std::chrono::nanoseconds initial_backoff = std::chrono::milliseconds{ 10 };
+    std::chrono::nanoseconds max_backoff = std::chrono::seconds{ 1 };
+    double multiplier = 2.0;
+    double jitter = 0.0;
+    std::function<bool(const E&)> is_retryable = [](const E&) { return true; };
+};
+
+struct ThreadSleeper {
+    void operator()(std::chrono::nanoseconds duration) const {
+        std::this_thread::sleep_for(duration);
+    }
+};
+
+template <
+    typename E,
+    typename C,
+    typename S,
+    typename URNG,
+    std::enable_if_t<
+        detail::is_invocable<C&>::value
+        && detail::is_expected_with_error<
+            std::decay_t<detail::invoke_result_t<C&>>,
+            E
+        >::value,
+        int
+    > = 0
+>
+std::decay_t<detail::invoke_result_t<C&>> retry(
+    const RetryPolicy<E> &policy,
+    C &&callable,
+    S &&sleeper,
+    URNG &engine
+) {
+    for (std::size_t attempt = 1; ; ++attempt) {
+        auto result = detail::invoke(callable);
+
+        if (!result.has_error() || attempt >= policy.max_attempts
+            || !policy.is_retryable(result.unwrap_error())) {
+            return result;
+        }
+
+        sleeper(detail::backoff_delay(
+            policy.initial_backoff,
+            policy.max_backoff,
+            policy.multiplier,
+            policy.jitter,
+            attempt,
+            engine
+        ));
+    }
+}
+
+template <
+    typename E,
+    typename C,
+    std::enable_if_t<
+        detail::is_invocable<C&>::value
+        && detail::is_expected_with_error<
+            std::decay_t<detail::invoke_result_t<C&>>,
+            E
+        >::value,
+        int
+    > = 0
+>
+std::decay_t<detail::invoke_result_t<C&>> retry(
+    const RetryPolicy<E> &policy,
+    C &&callable
+) {
+    return retry(policy, std::forward<C>(callable), ThreadSleeper{ },
+                 detail::jitter_engine());
+}
+
+template <typename Clock = std::chrono::steady_clock>
+class TimerWheel {
+public:
+    explicit TimerWheel(
+        std::chrono::nanoseconds resolution = std::chrono::milliseconds{ 1 },
+        std::size_t slots = 256
+    )
+    : resolution_{ resolution.count() > 0 ? resolution : std::chrono::nanoseconds{ 1 } },
+      slots_(slots == 0 ? 1 : slots), current_tick_{ tick_of(Clock::now()) } { }
+
+    void schedule_after(std::chrono::nanoseconds delay, std::function<void()> task) {
+        const std::int64_t deadline = tick_of(Clock::now() + delay);
+
+        const std::lock_guard<std::mutex> guard{ mutex_ };
+        const std::int64_t tick = deadline > current_tick_ ? deadline : current_tick_;
+
+        slots_[slot_of(tick)].push_back(Timer{ tick, std::move(task) });
+        ++pending_;
+    }
+
+    std::size_t run_expired() {
+        std::vector<std::function<void()>> expired;
+
+        {
+            const std::lock_guard<std::mutex> guard{ mutex_ };
+            const std::int64_t now = tick_of(Clock::now());
+            const std::int64_t last = std::min(
+                now,
+                current_tick_ + static_cast<std::int64_t>(slots_.size()) - 1
+            );
+
+            for (std::int64_t tick = current_tick_; tick <= last; ++tick) {
+                std::vector<Timer> &slot = slots_[slot_of(tick)];
+
+                for (auto it = slot.begin(); it != slot.end(); ) {
+                    if (it->deadline <= now) {
+                        expired.push_back(std::move(it->task));
+                        it = slot.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+
+            if (now >= current_tick_) {
+                current_tick_ = now + 1;
+            }
+
+            pending_ -= expired.size();
+        }
+
+        for (std::function<void()> &task : expired) {
+            task();
+        }
+
+        return expired.size();
+    }
+
+    std::size_t pending() const {
+        const std::lock_guard<std::mutex> guard{ mutex_ };
+
+        return pending_;
+    }
+
+private:
+    struct Timer {
+        std::int64_t deadline;
+        std::function<void()> task;
+    };
+
+    std::int64_t tick_of(typename Clock::time_point time) const noexcept {
+        const auto since_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            time.time_since_epoch()
+        );
+
+        return static_cast<std::int64_t>(since_epoch.count() / resolution_.count());
+    }
+
+    std::size_t slot_of(std::int64_t tick) const noexcept {
+        return static_cast<std::size_t>(tick) % slots_.size();
+    }
+
+    std::chrono::nanoseconds resolution_;
+    mutable std::mutex mutex_;
+    std::vector<std::vector<Timer>> slots_;
+    std::int64_t current_tick_;
+    std::size_t pending_ = 0;
+};
+
+template <
+    typename Clock,
+    typename E,
+    typename C,
+    typename D,
+    typename URNG,
+    std::enable_if_t<
+        detail::is_invocable<std::decay_t<C>&>::value
+        && detail::is_expected_with_error<
+            std::decay_t<detail::invoke_result_t<std::decay_t<C>&>>,
+            E
+        >::value,
+        int
+    > = 0
+>
+void retry_async(
+    TimerWheel<Clock> &wheel,
+    RetryPolicy<E> policy,
+    C &&callable,
+    D &&on_complete,
+    URNG engine
+) {
+    struct State : std::enable_shared_from_this<State> {
+        State(TimerWheel<Clock> &w, RetryPolicy<E> p, C &&c, D &&d, URNG e)
+        : wheel(w), policy(std::move(p)), callable(std::forward<C>(c)),
+          on_complete(std::forward<D>(d)), engine(std::move(e)) { }
+
+        void attempt() {
+            ++attempts;
+            auto result = detail::invoke(callable);
+
+            if (!result.has_error() || attempts >= policy.max_attempts
+                || !policy.is_retryable(result.unwrap_error())) {
+                detail::invoke(on_complete, std::move(result));
+
+                return;
+            }
+
+            const auto delay = detail::backoff_delay(
+                policy.initial_backoff,
+                policy.max_backoff,
+                policy.multiplier,
+                policy.jitter,
+                attempts,
+                engine
+            );
+            auto self = this->shared_from_this();
+
+            wheel.schedule_after(delay, [self] { self->attempt(); });
+        }
+
+        TimerWheel<Clock> &wheel;
+        RetryPolicy<E> policy;
+        std::decay_t<C> callable;
+        std::decay_t<D> on_complete;
+        URNG engine;
+        std::size_t attempts = 0;
+    };
+
+    std::make_shared<State>(
+        wheel,
+        std::move(policy),
+        std::forward<C>(callable),
+        std::forward<D>(on_complete),
+        std::move(engine)
+    )->attempt();
+}
+
+template <
+    typename Clock,
+    typename E,
+    typename C,
+    typename D,
+    std::enable_if_t<
+        detail::is_invocable<std::decay_t<C>&>::value
+        && detail::is_expected_with_error<
+            std::decay_t<detail::invoke_result_t<std::decay_t<C>&>>,
+            E
+        >::value,
+        int
+    > = 0
+>
+void retry_async(
+    TimerWheel<Clock> &wheel,
+    RetryPolicy<E> policy,
+    C &&callable,
+    D &&on_complete
+) {
+    retry_async(wheel, std::move(policy), std::forward<C>(callable),
+                std::forward<D>(on_complete),
+                std::minstd_rand{ detail::jitter_engine()() });
+}
+
+} // namespace monads
+
+#endif
@@ -0,0 +1,350 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_SERIALIZATION_HPP
+#define MONADS_SERIALIZATION_HPP
+
+#include <monads/expected.hpp>
+#include <monads/optional.hpp>
+
+#include <monads/detail/serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace monads {
+
+enum class SerializationError {
+    BufferTooSmall,
+    Misaligned,
+    BadMagic,
+    UnsupportedVersion,
+    ByteOrderMismatch,
+    LayoutMismatch,
+    BadState
+};
+
+namespace detail {
+
+template <typename T>
+constexpr SerialLayout optional_layout() noexcept {
+    return SerialLayout{ alignof(T), sizeof(T), 0 };
+}
+
+template <typename T, typename E>
+constexpr SerialLayout expected_layout() noexcept {
+    return SerialLayout{ max_size(alignof(T), alignof(E)), sizeof(T), sizeof(E) };
+}
+
+inline Expected<std::size_t, SerializationError> write_record(
+    void *buffer,
+    std::size_t size,
+    SerialKind kind,
+    const SerialLayout &layout,
+    SerialState state,
+    const void *payload,
+    std::size_t payload_size
+) noexcept {
+    if (size < layout.size()) {
+        return Expected<std::size_t, SerializationError>{
+            InPlaceErrorType{ },
+            SerializationError::BufferTooSmall
+        };
+    }
+
+    const SerialHeader header{
+        SERIAL_MAGIC,
+        SERIAL_VERSION,
+        native_byte_order(),
+        static_cast<std::uint8_t>(kind),
+        static_cast<std::uint8_t>(layout.alignment),
+        static_cast<std::uint32_t>(layout.value_size),
+        static_cast<std::uint32_t>(layout.error_size)
+    };
+
+    unsigned char *const bytes = static_cast<unsigned char*>(buffer);
+
+    std::memset(bytes, 0, layout.size());
+    std::memcpy(bytes, &header, sizeof(header));
+    bytes[layout.state_offset()] = static_cast<unsigned char>(state);
+
+    if (payload) {
+        std::memcpy(bytes + layout.payload_offset(), payload, payload_size);
+    }
+
+    return Expected<std::size_t, SerializationError>{ InPlaceValueType{ }, layout.size() };
+}
+
+inline Optional<SerializationError> check_record(
+    const void *buffer,
+    std::size_t size,
+    SerialKind kind,
+    const SerialLayout &layout
+) noexcept {
+    if (size < layout.size()) {
+        return SerializationError::BufferTooSmall;
+    }
+
+    if (reinterpret_cast<std::uintptr_t>(buffer) % layout.alignment != 0) {
+        return SerializationError::Misaligned;
+    }
+
+    SerialHeader header;
+    std::memcpy(&header, buffer, sizeof(header));
+
+    if (header.magic == SERIAL_MAGIC_SWAPPED) {
+        return SerializationError::ByteOrderMismatch;
+    } else if (header.magic != SERIAL_MAGIC) {
+        return SerializationError::BadMagic;
+    } else if (header.version != SERIAL_VERSION) {
+        return SerializationError::UnsupportedVersion;
+    } else if (header.byte_order != native_byte_order()) {
+        return SerializationError::ByteOrderMismatch;
+    } else if (header.kind != static_cast<std::uint8_t>(kind)
+               || header.alignment != layout.alignment
+               || header.value_size != layout.value_size
+               || header.error_size != layout.error_size) {
+        return SerializationError::LayoutMismatch;
+    }
+
+    const unsigned char state = static_cast<const unsigned char*>(buffer)[layout.state_offset()];
+
+    if (state > static_cast<unsigned char>(SerialState::Error)
+        || (kind == SerialKind::Optional
+            && state == static_cast<unsigned char>(SerialState::Error))) {
+        return SerializationError::BadState;
+    }
+
+    return Optional<SerializationError>{ };
+}
+
+} // namespace detail
+
+template <typename T>
+class OptionalView {
+public:
+    constexpr explicit OptionalView(const T *value) noexcept : value_{ value } { }
+
+    constexpr bool has_value() const noexcept {
+        return value_ != nullptr;
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    constexpr const T& operator*() const noexcept {
+        return *value_;
+    }
+
+    constexpr const T* operator->() const noexcept {
+        return value_;
+    }
+
+    constexpr const T& unwrap() const noexcept {
+        return *value_;
+    }
+
+    Optional<T> to_optional() const noexcept {
+        return has_value() ? Optional<T>{ InPlaceType{ }, *value_ } : Optional<T>{ };
+    }
+
+private:
+    const T *value_;
+};
+
+template <typename T, typename E>
+class ExpectedView {
+public:
+    constexpr ExpectedView(const T *value, const E *error) noexcept
+    : value_{ value }, error_{ value ? nullptr : error } { }
+
+    constexpr bool has_value() const noexcept {
+        return value_ != nullptr;
+    }
+
+    constexpr bool has_error() const noexcept {
+        return error_ != nullptr;
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    constexpr const T& operator*() const noexcept {
+        return *value_;
+    }
+
+    constexpr const T* operator->() const noexcept {
+        return value_;
+    }
+
+    constexpr const T& unwrap() const noexcept {
+        return *value_;
+    }
+
+    constexpr const E& unwrap_error() const noexcept {
+        return *error_;
+    }
+
+private:
+    const T *value_;
+    const E *error_;
+};
+
+template <typename T>
+constexpr std::size_t serialized_size(const Optional<T>&) noexcept {
+    return detail::optional_layout<T>().size();
+}
+
+template <typename T, typename E>
+constexpr std::size_t serialized_size(const Expected<T, E>&) noexcept {
+    return detail::expected_layout<T, E>().size();
+}
+
+template <typename T>
+Expected<std::size_t, SerializationError> serialize(
+    const Optional<T> &optional,
+    void *buffer,
+    std::size_t size
+) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "only trivially copyable payloads can be serialized");
+    static_assert(alignof(T) <= detail::SERIAL_MAX_ALIGNMENT,
+                  "the payload alignment must fit in the record header");
+
+    return detail::write_record(
+        buffer,
+        size,
+        detail::SerialKind::Optional,
+        detail::optional_layout<T>(),
+        optional.has_value() ? detail::SerialState::Value : detail::SerialState::Empty,
+        optional.has_value() ? std::addressof(optional.unwrap()) : nullptr,
+        sizeof(T)
+    );
+}
+
+template <typename T, typename E>
+Expected<std::size_t, SerializationError> serialize(
+    const Expected<T, E> &expected,
+    void *buffer,
+    std::size_t size
+) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value
+                  && std::is_trivially_copyable<E>::value,
+                  "only trivially copyable payloads can be serialized");
+    static_assert(alignof(T) <= detail::SERIAL_MAX_ALIGNMENT
+                  && alignof(E) <= detail::SERIAL_MAX_ALIGNMENT,
+                  "the payload alignment must fit in the record header");
+
+    if (expected.has_value()) {
+        return detail::write_record(buffer, size, detail::SerialKind::Expected,
+                                    detail::expected_layout<T, E>(),
+                                    detail::SerialState::Value,
+                                    std::addressof(expected.unwrap()), sizeof(T));
+    } else if (expected.has_error()) {
+        return detail::write_record(buffer, size, detail::SerialKind::Expected,
+                                    detail::expected_layout<T, E>(),
+                                    detail::SerialState::Error,
+                                    std::addressof(expected.unwrap_error()), sizeof(E));
+    }
+
+    return detail::write_record(buffer, size, detail::SerialKind::Expected,
+                                detail::expected_layout<T, E>(),
+                                detail::SerialState::Empty, nullptr, 0);
+}
+
+template <typename T>
+Expected<OptionalView<T>, SerializationError> view_optional(
+    const void *buffer,
+    std::size_t size
+) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "only trivially copyable payloads can be serialized");
+    static_assert(alignof(T) <= detail::SERIAL_MAX_ALIGNMENT,
+                  "the payload alignment must fit in the record header");
+
+    constexpr detail::SerialLayout layout = detail::optional_layout<T>();
+    const Optional<SerializationError> error =
+        detail::check_record(buffer, size, detail::SerialKind::Optional, layout);
+
+    if (error) {
+        return Expected<OptionalView<T>, SerializationError>{ InPlaceErrorType{ }, *error };
+    }
+
+    const unsigned char *const bytes = static_cast<const unsigned char*>(buffer);
+    const bool has_value =
+        bytes[layout.state_offset()] == static_cast<unsigned char>(detail::SerialState::Value);
+
+    return Expected<OptionalView<T>, SerializationError>{
+        InPlaceValueType{ },
+        has_value ? reinterpret_cast<const T*>(bytes + layout.payload_offset()) : nullptr
+    };
+}
+
+template <typename T, typename E>
+Expected<ExpectedView<T, E>, SerializationError> view_expected(
+    const void *buffer,
+    std::size_t size
+) noexcept {
+    static_assert(std::is_trivially_copyable<T>::value
+                  && std::is_trivially_copyable<E>::value,
+                  "only trivially copyable payloads can be serialized");
+    static_assert(alignof(T) <= detail::SERIAL_MAX_ALIGNMENT
+                  && alignof(E) <= detail::SERIAL_MAX_ALIGNMENT,
+                  "the payload alignment must fit in the record header");
+
+    constexpr detail::SerialLayout layout = detail::expected_layout<T, E>();
+    const Optional<SerializationError> error =
+        detail::check_record(buffer, size, detail::SerialKind::Expected, layout);
+
+    if (error) {
+        return Expected<ExpectedView<T, E>, SerializationError>{ InPlaceErrorType{ }, *error };
+    }
+
+    const unsigned char *const bytes = static_cast<const unsigned char*>(buffer);
+    const unsigned char state = bytes[layout.state_offset()];
+    const unsigned char *const payload = bytes + layout.payload_offset();
+
+    return Expected<ExpectedView<T, E>, SerializationError>{
+        InPlaceValueType{ },
+        state == static_cast<unsigned char>(detail::SerialState::Value)
+            ? reinterpret_cast<const T*>(payload) : nullptr,
+        state == static_cast<unsigned char>(detail::SerialState::Error)
+            ? reinterpret_cast<const E*>(payload) : nullptr
+    };
+}
+
+} // namespace monads
+
+#endif
@@ -0,0 +1,124 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_STATIC_ERROR_HPP
+#define MONADS_STATIC_ERROR_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/static_error.hpp>
+
+#include <system_error>
+#include <type_traits>
+
+// declares a tag type and a StaticError constant that refers to its interned
+// descriptor
+#define MONADS_STATIC_ERROR(IDENTIFIER, NAME, CODE, CATEGORY) \
+    struct IDENTIFIER##_descriptor_tag { \
+        static constexpr const char *name = NAME; \
+        static constexpr int code = CODE; \
+        static constexpr const char *category = CATEGORY; \
+    }; \
+    constexpr ::monads::StaticError IDENTIFIER = \
+        ::monads::StaticError::of<IDENTIFIER##_descriptor_tag>()
+
+namespace monads {
+
+class StaticError {
+public:
+    template <typename Tag>
+    static constexpr StaticError of() noexcept {
+        static_assert(detail::is_static_error_tag<Tag>::value,
+                      "Tag must have static constexpr name, code and category members");
+
+        return StaticError{ detail::StaticErrorRegistry<Tag>::descriptor };
+    }
+
+    constexpr explicit StaticError(const ErrorDescriptor &descriptor) noexcept
+    : descriptor_{ &descriptor } { }
+
+    constexpr const ErrorDescriptor& descriptor() const noexcept {
+        return *descriptor_;
+    }
+
+    constexpr const char* name() const noexcept {
+        return descriptor_->name;
+    }
+
+    constexpr int code() const noexcept {
+        return descriptor_->code;
+    }
+
+    constexpr const char* category() const noexcept {
+        return descriptor_->category;
+    }
+
+    constexpr const char* what() const noexcept {
+        return descriptor_->name;
+    }
+
+    friend constexpr bool operator==(StaticError lhs, StaticError rhs) noexcept {
+        return lhs.descriptor_ == rhs.descriptor_;
+    }
+
+    friend constexpr bool operator!=(StaticError lhs, StaticError rhs) noexcept {
+        return lhs.descriptor_ != rhs.descriptor_;
+    }
+
+private:
+    const ErrorDescriptor *descriptor_;
+};
+
+template <typename T>
+constexpr Expected<T, StaticError> make_unexpected(StaticError error) noexcept {
+    return Expected<T, StaticError>{ InPlaceErrorType{ }, error };
+}
+
+namespace errors {
+
+MONADS_STATIC_ERROR(not_found, "not found",
+                    static_cast<int>(std::errc::no_such_file_or_directory), "generic");
+
+MONADS_STATIC_ERROR(timeout, "timeout", static_cast<int>(std::errc::timed_out), "generic");
+
+MONADS_STATIC_ERROR(invalid_argument, "invalid argument",
+                    static_cast<int>(std::errc::invalid_argument), "generic");
+
+MONADS_STATIC_ERROR(permission_denied, "permission denied",
+                    static_cast<int>(std::errc::permission_denied), "generic");
+
+MONADS_STATIC_ERROR(cancelled, "cancelled",
+                    static_cast<int>(std::errc::operation_canceled), "generic");
+
+} // namespace errors
+} // namespace monads
+
+#endif
@@ -0,0 +1,129 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_THREAD_POOL_HPP
+#define MONADS_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace monads {
+
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency()) {
+        const std::size_t count = threads == 0 ? 1 : threads;
+
+        workers_.reserve(count);
+
+        try {
+            for (std::size_t i = 0; i < count; ++i) {
+                workers_.emplace_back([this] { work(); });
+            }
+        } catch (...) {
+            // destroying a joinable thread terminates, so join what did start
+            stop();
+
+            throw;
+        }
+    }
+
+    ThreadPool(const ThreadPool &other) = delete;
+
+    ~ThreadPool() {
+        stop();
+    }
+
+    ThreadPool& operator=(const ThreadPool &other) = delete;
+
+    std::size_t size() const noexcept {
+        return workers_.size();
+    }
+
+    void submit(std::function<void()> task) {
+        {
+            const std::lock_guard<std::mutex> guard{ mutex_ };
+            tasks_.push_back(std::move(task));
+        }
+
+        ready_.notify_one();
+    }
+
+private:
+    void stop() noexcept {
+        {
+            const std::lock_guard<std::mutex> guard{ mutex_ };
+            stopping_ = true;
+        }
+
+        ready_.notify_all();
+
+        for (std::thread &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void work() {
+        while (true) {
+            std::function<void()> task;
+
+            {
+                std::unique_lock<std::mutex> lock{ mutex_ };
+                ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+
+                if (tasks_.empty()) {
+                    return;
+                }
+
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+};
+
+} // namespace monads
+
+#endif
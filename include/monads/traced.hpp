@@ -0,0 +1,244 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_TRACED_HPP
+#define MONADS_TRACED_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/instrumentation.hpp>
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/stack_trace.hpp>
+#include <monads/detail/try_invoke.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#define MONADS_HAS_DLADDR
+#endif
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace monads {
+
+struct StackFrame {
+    void *address;
+    std::string module;
+    std::string symbol;
+    std::uintptr_t offset;
+};
+
+class StackTrace {
+public:
+    static constexpr std::size_t MAX_FRAMES = 32;
+
+    static std::shared_ptr<const StackTrace> capture() noexcept {
+        try {
+            auto trace = std::make_shared<StackTrace>();
+            trace->size_ = detail::walk_frame_pointers(trace->frames_, MAX_FRAMES);
+
+            return trace;
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    void* operator[](std::size_t index) const noexcept {
+        return frames_[index];
+    }
+
+    std::vector<StackFrame> symbolize() const {
+        std::vector<StackFrame> symbolized;
+        symbolized.reserve(size_);
+
+        for (std::size_t i = 0; i < size_; ++i) {
+            symbolized.push_back(symbolize(frames_[i]));
+        }
+
+        return symbolized;
+    }
+
+private:
+    static StackFrame symbolize(void *address) {
+        StackFrame frame{ address, { }, { }, 0 };
+
+#ifdef MONADS_HAS_DLADDR
+        Dl_info info;
+
+        if (dladdr(address, &info) == 0) {
+            return frame;
+        }
+
+        if (info.dli_fname) {
+            frame.module = info.dli_fname;
+        }
+
+        if (info.dli_sname) {
+            frame.symbol = demangle(info.dli_sname);
+            frame.offset = reinterpret_cast<std::uintptr_t>(address)
+                           - reinterpret_cast<std::uintptr_t>(info.dli_saddr);
+        } else if (info.dli_fbase) {
+            frame.offset = reinterpret_cast<std::uintptr_t>(address)
+                           - reinterpret_cast<std::uintptr_t>(info.dli_fbase);
+        }
+#endif
+
+        return frame;
+    }
+
+    static std::string demangle(const char *name) {
+#if defined(__GNUG__)
+        int status = 0;
+        char *const demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+
+        if (status == 0 && demangled) {
+            std::string result{ demangled };
+            std::free(demangled);
+
+            return result;
+        }
+#endif
+
+        return name;
+    }
+
+    void *frames_[MAX_FRAMES];
+    std::size_t size_ = 0;
+};
+
+inline void set_trace_sample_rate(std::uint32_t every_n) noexcept {
+    detail::trace_sample_rate().store(every_n, std::memory_order_relaxed);
+}
+
+inline std::uint32_t trace_sample_rate() noexcept {
+    return detail::trace_sample_rate().load(std::memory_order_relaxed);
+}
+
+template <typename E>
+class Traced {
+public:
+    Traced(const E &error) noexcept(std::is_nothrow_copy_constructible<E>::value)
+    : error_(error), trace_{ sample() } { }
+
+    Traced(E &&error) noexcept(std::is_nothrow_move_constructible<E>::value)
+    : error_(std::move(error)), trace_{ sample() } { }
+
+    template <typename ...Ts, std::enable_if_t<std::is_constructible<E, Ts&&...>::value, int> = 0>
+    explicit Traced(InPlaceErrorType, Ts &&...ts)
+    noexcept(std::is_nothrow_constructible<E, Ts&&...>::value)
+    : error_(std::forward<Ts>(ts)...), trace_{ sample() } { }
+
+    E& error() & noexcept {
+        return error_;
+    }
+
+    const E& error() const & noexcept {
+        return error_;
+    }
+
+    E&& error() && noexcept {
+        return std::move(error_);
+    }
+
+    bool has_trace() const noexcept {
+        return static_cast<bool>(trace_);
+    }
+
+    const StackTrace* trace() const noexcept {
+        return trace_.get();
+    }
+
+private:
+    static std::shared_ptr<const StackTrace> sample() noexcept {
+        if (!detail::should_sample_trace()) {
+            return nullptr;
+        }
+
+        return StackTrace::capture();
+    }
+
+    E error_;
+    std::shared_ptr<const StackTrace> trace_;
+};
+
+namespace detail {
+
+template <typename E>
+struct TryInvoker<Traced<E>> {
+    template <
+        typename C,
+        typename ...Ts,
+        std::enable_if_t<is_invocable<C&&, Ts&&...>::value, int> = 0
+    >
+    Expected<invoke_result_t<C&&, Ts&&...>, Traced<E>> operator()(
+        C &&callable,
+        Ts &&...ts
+    ) noexcept(std::is_nothrow_copy_constructible<E>::value) {
+        using Result = invoke_result_t<C&&, Ts&&...>;
+        using Expected = Expected<Result, Traced<E>>;
+
+        try {
+            return Expected{
+                InPlaceValueType{ },
+                detail::invoke(std::forward<C>(callable), std::forward<Ts>(ts)...)
+            };
+        } catch (const E &err) {
+            record_error<Traced<E>>(site);
+
+            return Expected{ InPlaceErrorType{ }, err };
+        }
+    }
+
+    ErrorSite site;
+};
+
+} // namespace detail
+} // namespace monads
+
+#endif
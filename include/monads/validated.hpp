@@ -0,0 +1,271 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_VALIDATED_HPP
+#define MONADS_VALIDATED_HPP
+
+#include <monads/expected.hpp>
+
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/small_vector.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+template <typename T, typename E, std::size_t N = 4>
+class Validated {
+public:
+    static_assert(N >= 1, "Validated must have room for at least one inline error");
+
+    using Errors = detail::SmallVector<E, N>;
+
+    template <typename U, typename F, std::size_t M>
+    friend class Validated;
+
+    template <typename ...Ts, std::enable_if_t<std::is_constructible<T, Ts&&...>::value, int> = 0>
+    explicit Validated(InPlaceValueType, Ts &&...ts)
+    noexcept(std::is_nothrow_constructible<T, Ts&&...>::value)
+    : inner_{ InPlaceValueType{ }, std::forward<Ts>(ts)... } { }
+
+    template <typename ...Ts, std::enable_if_t<std::is_constructible<E, Ts&&...>::value, int> = 0>
+    explicit Validated(InPlaceErrorType, Ts &&...ts)
+    : inner_{ InPlaceErrorType{ }, Errors{ } } {
+        inner_.unwrap_error().emplace_back(std::forward<Ts>(ts)...);
+    }
+
+    Validated(InPlaceErrorType, Errors errors)
+    noexcept(std::is_nothrow_move_constructible<E>::value)
+    : inner_{ InPlaceErrorType{ }, std::move(errors) } { }
+
+    // an Expected left valueless by a throwing emplace holds no error to
+    // accumulate, so it is rejected rather than becoming an empty error list
+    template <typename U = T, std::enable_if_t<
+        std::is_copy_constructible<U>::value && std::is_copy_constructible<E>::value,
+        int
+    > = 0>
+    Validated(const Expected<T, E> &expected) : Validated{ InPlaceErrorType{ }, Errors{ } } {
+        if (expected.has_value()) {
+            inner_.emplace(expected.unwrap());
+        } else if (expected.has_error()) {
+            inner_.unwrap_error().push_back(expected.unwrap_error());
+        } else {
+            throw BadExpectedAccess{ };
+        }
+    }
+
+    template <typename U = T, std::enable_if_t<
+        std::is_move_constructible<U>::value && std::is_move_constructible<E>::value,
+        int
+    > = 0>
+    Validated(Expected<T, E> &&expected) : Validated{ InPlaceErrorType{ }, Errors{ } } {
+        if (expected.has_value()) {
+            inner_.emplace(std::move(expected).unwrap());
+        } else if (expected.has_error()) {
+            inner_.unwrap_error().push_back(std::move(expected).unwrap_error());
+        } else {
+            throw BadExpectedAccess{ };
+        }
+    }
+
+    bool has_value() const noexcept {
+        return inner_.has_value();
+    }
+
+    bool has_error() const noexcept {
+        return !inner_.has_value();
+    }
+
+    explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    bool operator!() const noexcept {
+        return !has_value();
+    }
+
+    const T& value() const & {
+        if (!has_value()) {
+            throw BadExpectedAccess{ };
+        }
+
+        return unwrap();
+    }
+
+    T&& value() && {
+        if (!has_value()) {
+            throw BadExpectedAccess{ };
+        }
+
+        return std::move(*this).unwrap();
+    }
+
+    const Errors& errors() const & {
+        if (!has_error()) {
+            throw BadExpectedAccess{ };
+        }
+
+        return unwrap_errors();
+    }
+
+    Errors&& errors() && {
+        if (!has_error()) {
+            throw BadExpectedAccess{ };
+        }
+
+        return std::move(*this).unwrap_errors();
+    }
+
+    const T& unwrap() const & noexcept {
+        return inner_.unwrap();
+    }
+
+    T&& unwrap() && noexcept {
+        return std::move(inner_).unwrap();
+    }
+
+    const Errors& unwrap_errors() const & noexcept {
+        return inner_.unwrap_error();
+    }
+
+    Errors&& unwrap_errors() && noexcept {
+        return std::move(inner_).unwrap_error();
+    }
+
+    const Expected<T, Errors>& to_expected() const & noexcept {
+        return inner_;
+    }
+
+    Expected<T, Errors> to_expected() && {
+        return std::move(inner_);
+    }
+
+    template <
+        typename C,
+        std::enable_if_t<detail::is_invocable<C&&, const T&>::value, int> = 0
+    >
+    Validated<detail::invoke_result_t<C&&, const T&>, E, N> map(C &&callable) const & {
+        using U = detail::invoke_result_t<C&&, const T&>;
+
+        if (!has_value()) {
+            return Validated<U, E, N>{ InPlaceErrorType{ }, unwrap_errors() };
+        }
+
+        return Validated<U, E, N>{
+            InPlaceValueType{ },
+            detail::invoke(std::forward<C>(callable), unwrap())
+        };
+    }
+
+    template <
+        typename C,
+        std::enable_if_t<detail::is_invocable<C&&, T&&>::value, int> = 0
+    >
+    Validated<detail::invoke_result_t<C&&, T&&>, E, N> map(C &&callable) && {
+        using U = detail::invoke_result_t<C&&, T&&>;
+
+        if (!has_value()) {
+            return Validated<U, E, N>{
+                InPlaceErrorType{ },
+                std::move(*this).unwrap_errors()
+            };
+        }
+
+        return Validated<U, E, N>{
+            InPlaceValueType{ },
+            detail::invoke(std::forward<C>(callable), std::move(*this).unwrap())
+        };
+    }
+
+private:
+    Expected<T, Errors> inner_;
+};
+
+template <typename T, typename E, std::size_t N = 4, typename ...Ts>
+Validated<T, E, N> make_valid(Ts &&...ts) {
+    return Validated<T, E, N>{ InPlaceValueType{ }, std::forward<Ts>(ts)... };
+}
+
+template <typename T, typename E, std::size_t N = 4, typename ...Ts>
+Validated<T, E, N> make_invalid(Ts &&...ts) {
+    return Validated<T, E, N>{ InPlaceErrorType{ }, std::forward<Ts>(ts)... };
+}
+
+template <
+    typename C,
+    typename E,
+    std::size_t N,
+    typename ...Ts,
+    std::enable_if_t<detail::is_invocable<C&&, const Ts&...>::value, int> = 0
+>
+Validated<detail::invoke_result_t<C&&, const Ts&...>, E, N> combine(
+    C &&callable,
+    const Validated<Ts, E, N> &...validated
+) {
+    using Result = Validated<detail::invoke_result_t<C&&, const Ts&...>, E, N>;
+
+    const bool is_valid[] = { true, validated.has_value()... };
+    bool all_valid = true;
+
+    for (const bool valid : is_valid) {
+        all_valid = all_valid && valid;
+    }
+
+    if (all_valid) {
+        return Result{
+            InPlaceValueType{ },
+            detail::invoke(std::forward<C>(callable), validated.unwrap()...)
+        };
+    }
+
+    typename Result::Errors errors;
+
+    const auto append = [&errors](const auto &each) {
+        if (each.has_error()) {
+            for (const E &error : each.unwrap_errors()) {
+                errors.push_back(error);
+            }
+        }
+
+        return 0;
+    };
+
+    const int expand[] = { 0, append(validated)... };
+    static_cast<void>(expand);
+
+    return Result{ InPlaceErrorType{ }, std::move(errors) };
+}
+
+} // namespace monads
+
+#endif
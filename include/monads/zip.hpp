@@ -0,0 +1,154 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MONADS_ZIP_HPP
+#define MONADS_ZIP_HPP
+
+#include <monads/expected.hpp>
+#include <monads/optional.hpp>
+
+#include <monads/detail/invoke.hpp>
+#include <monads/detail/zip.hpp>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace monads {
+
+template <
+    typename ...Ms,
+    std::enable_if_t<sizeof...(Ms) != 0 && detail::all_optionals<Ms...>::value, int> = 0
+>
+constexpr Optional<std::tuple<detail::unwrapped_t<Ms>...>> zip(Ms &&...optionals) {
+    using Result = Optional<std::tuple<detail::unwrapped_t<Ms>...>>;
+
+    if (!detail::all_flags(optionals.has_value()...)) {
+        return Result{ };
+    }
+
+    return Result{ InPlaceType{ }, std::forward<Ms>(optionals).unwrap()... };
+}
+
+template <
+    typename C,
+    typename ...Ms,
+    std::enable_if_t<
+        sizeof...(Ms) != 0 && detail::all_optionals<Ms...>::value
+        && detail::is_invocable<C&&, decltype(std::declval<Ms>().unwrap())...>::value,
+        int
+    > = 0
+>
+constexpr Optional<std::decay_t<
+    detail::invoke_result_t<C&&, decltype(std::declval<Ms>().unwrap())...>
+>> zip_with(C &&callable, Ms &&...optionals) {
+    using Result = Optional<std::decay_t<
+        detail::invoke_result_t<C&&, decltype(std::declval<Ms>().unwrap())...>
+    >>;
+
+    if (!detail::all_flags(optionals.has_value()...)) {
+        return Result{ };
+    }
+
+    return Result{
+        InPlaceType{ },
+        detail::invoke(std::forward<C>(callable), std::forward<Ms>(optionals).unwrap()...)
+    };
+}
+
+template <
+    typename M,
+    typename ...Ms,
+    std::enable_if_t<detail::all_expecteds_with_error<M, Ms...>::value, int> = 0
+>
+Expected<
+    std::tuple<detail::unwrapped_t<M>, detail::unwrapped_t<Ms>...>,
+    detail::expected_error_t<std::decay_t<M>>
+> zip(M &&expected, Ms &&...expecteds) {
+    using T = std::tuple<detail::unwrapped_t<M>, detail::unwrapped_t<Ms>...>;
+    using Result = Expected<T, detail::expected_error_t<std::decay_t<M>>>;
+
+    if (!detail::all_flags(expected.has_value(), expecteds.has_value()...)) {
+        return detail::first_failure<T>(std::forward<M>(expected),
+                                        std::forward<Ms>(expecteds)...);
+    }
+
+    return Result{
+        InPlaceValueType{ },
+        std::forward<M>(expected).unwrap(),
+        std::forward<Ms>(expecteds).unwrap()...
+    };
+}
+
+template <
+    typename C,
+    typename M,
+    typename ...Ms,
+    std::enable_if_t<
+        detail::all_expecteds_with_error<M, Ms...>::value
+        && detail::is_invocable<
+            C&&,
+            decltype(std::declval<M>().unwrap()),
+            decltype(std::declval<Ms>().unwrap())...
+        >::value,
+        int
+    > = 0
+>
+Expected<
+    std::decay_t<detail::invoke_result_t<
+        C&&,
+        decltype(std::declval<M>().unwrap()),
+        decltype(std::declval<Ms>().unwrap())...
+    >>,
+    detail::expected_error_t<std::decay_t<M>>
+> zip_with(C &&callable, M &&expected, Ms &&...expecteds) {
+    using T = std::decay_t<detail::invoke_result_t<
+        C&&,
+        decltype(std::declval<M>().unwrap()),
+        decltype(std::declval<Ms>().unwrap())...
+    >>;
+    using Result = Expected<T, detail::expected_error_t<std::decay_t<M>>>;
+
+    if (!detail::all_flags(expected.has_value(), expecteds.has_value()...)) {
+        return detail::first_failure<T>(std::forward<M>(expected),
+                                        std::forward<Ms>(expecteds)...);
+    }
+
+    return Result{
+        InPlaceValueType{ },
+        detail::invoke(std::forward<C>(callable), std::forward<M>(expected).unwrap(),
+                       std::forward<Ms>(expecteds).unwrap()...)
+    };
+}
+
+} // namespace monads
+
+#endif
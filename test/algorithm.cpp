@@ -0,0 +1,255 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/algorithm.hpp>
+#include <monads/thread_pool.hpp>
+
+#include "catch.hpp"
+
+#include <atomic>
+#include <deque>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO(
+    "monads::partition_expected",
+    "[monads][monads/algorithm.hpp][monads::partition_expected]"
+) {
+    using Result = monads::Expected<std::string, int>;
+
+    GIVEN("a vector of Expecteds") {
+        std::vector<Result> results;
+
+        for (int i = 0; i < 10; ++i) {
+            if (i % 4 == 0) {
+                results.emplace_back(monads::InPlaceErrorType{ }, i);
+            } else {
+                results.emplace_back(monads::InPlaceValueType{ }, std::string(32, static_cast<char>('a' + i)));
+            }
+        }
+
+        WHEN("it is partitioned by reference") {
+            std::vector<std::string> values{ "existing" };
+            std::vector<int> errors;
+
+            const auto counts = monads::partition_expected(results, values, errors);
+
+            THEN("values and errors are copied out in order") {
+                REQUIRE(counts.values == 7);
+                REQUIRE(counts.errors == 3);
+                REQUIRE(values.size() == 8);
+                REQUIRE(values[1] == std::string(32, 'b'));
+                REQUIRE(errors == (std::vector<int>{ 0, 4, 8 }));
+                REQUIRE(results[1].unwrap() == std::string(32, 'b'));
+            }
+
+            THEN("the outputs are reserved exactly") {
+                REQUIRE(values.capacity() == 8);
+                REQUIRE(errors.capacity() == 3);
+            }
+        }
+
+        WHEN("it is partitioned as an rvalue") {
+            std::vector<std::string> values;
+            std::deque<int> errors;
+
+            monads::partition_expected(std::move(results), values, errors);
+
+            THEN("the payloads are moved") {
+                REQUIRE(values.size() == 7);
+                REQUIRE(values[0] == std::string(32, 'b'));
+                REQUIRE(errors.size() == 3);
+                REQUIRE(results[1].unwrap().empty());
+            }
+        }
+    }
+
+    GIVEN("a list of move-only values") {
+        std::list<monads::Expected<std::unique_ptr<int>, int>> results;
+        results.emplace_back(monads::InPlaceValueType{ }, new int{ 1 });
+        results.emplace_back(monads::InPlaceErrorType{ }, 2);
+
+        WHEN("it is partitioned as an rvalue") {
+            std::vector<std::unique_ptr<int>> values;
+            std::vector<int> errors;
+
+            const auto counts = monads::partition_expected(std::move(results), values, errors);
+
+            THEN("the values are moved out") {
+                REQUIRE(counts.values == 1);
+                REQUIRE(*values[0] == 1);
+                REQUIRE(errors == (std::vector<int>{ 2 }));
+            }
+        }
+    }
+}
+
+SCENARIO(
+    "monads::try_accumulate and monads::try_reduce",
+    "[monads][monads/algorithm.hpp][monads::try_accumulate][monads::try_reduce]"
+) {
+    using Result = monads::Expected<long, std::string>;
+
+    int calls = 0;
+    const auto checked_add = [&calls](long total, int x) -> Result {
+        ++calls;
+
+        if (x < 0) {
+            return Result{ monads::InPlaceErrorType{ }, "negative " + std::to_string(x) };
+        }
+
+        return Result{ monads::InPlaceValueType{ }, total + x };
+    };
+
+    GIVEN("a range without errors") {
+        const std::vector<int> numbers{ 1, 2, 3, 4 };
+
+        THEN("every element is accumulated") {
+            REQUIRE(monads::try_accumulate(numbers.begin(), numbers.end(), 10L, checked_add)
+                        .unwrap() == 20);
+            REQUIRE(monads::try_reduce(numbers.begin(), numbers.end(), 0L, checked_add)
+                        .unwrap() == 10);
+        }
+    }
+
+    GIVEN("a range with an error") {
+        const std::vector<int> numbers{ 1, -2, 3, -4 };
+        const auto result = monads::try_accumulate(numbers.begin(), numbers.end(), 0L,
+                                                   checked_add);
+
+        THEN("accumulation stops at the first error") {
+            REQUIRE(result.unwrap_error() == "negative -2");
+            REQUIRE(calls == 2);
+        }
+    }
+
+    GIVEN("an empty range") {
+        const std::vector<int> numbers;
+
+        THEN("the initial value is returned") {
+            REQUIRE(monads::try_accumulate(numbers.begin(), numbers.end(), 7L, checked_add)
+                        .unwrap() == 7);
+        }
+    }
+}
+
+SCENARIO(
+    "monads::try_reduce on a thread pool",
+    "[monads][monads/algorithm.hpp][monads::try_reduce][monads::ThreadPool]"
+) {
+    using Result = monads::Expected<long, std::string>;
+
+    monads::ThreadPool pool{ 4 };
+    std::atomic<long> calls{ 0 };
+    const auto checked_add = [&calls](long total, long x) -> Result {
+        calls.fetch_add(1, std::memory_order_relaxed);
+
+        if (x < 0) {
+            return Result{ monads::InPlaceErrorType{ }, "negative " + std::to_string(x) };
+        }
+
+        return Result{ monads::InPlaceValueType{ }, total + x };
+    };
+
+    std::vector<long> numbers(100000);
+    std::iota(numbers.begin(), numbers.end(), 1L);
+
+    WHEN("no element fails") {
+        const auto result = monads::try_reduce(pool, numbers.begin(), numbers.end(), 0L,
+                                               checked_add, 1000);
+
+        THEN("the result matches a sequential reduction") {
+            REQUIRE(result.unwrap() == 100000L * 100001 / 2);
+        }
+    }
+
+    WHEN("several elements fail") {
+        numbers[70000] = -2;
+        numbers[30000] = -1;
+
+        const auto result = monads::try_reduce(pool, numbers.begin(), numbers.end(), 0L,
+                                               checked_add, 1000);
+
+        THEN("the first error in range order is reported") {
+            REQUIRE(result.unwrap_error() == "negative -1");
+        }
+    }
+
+    WHEN("the first chunk fails on a single worker") {
+        monads::ThreadPool serial{ 1 };
+        numbers[0] = -1;
+
+        const auto result = monads::try_reduce(serial, numbers.begin(), numbers.end(), 0L,
+                                               checked_add, 1000);
+
+        THEN("the chunks after it are skipped") {
+            REQUIRE(result.unwrap_error() == "negative -1");
+            REQUIRE(calls == 1);
+        }
+    }
+
+    WHEN("the operation throws on a worker") {
+        std::thread::id thrower;
+        const auto throwing_add = [&thrower](long total, long x) -> Result {
+            if (x == 50000) {
+                thrower = std::this_thread::get_id();
+
+                throw std::runtime_error{ "overflow" };
+            }
+
+            return Result{ monads::InPlaceValueType{ }, total + x };
+        };
+
+        THEN("the exception is rethrown on the calling thread") {
+            REQUIRE_THROWS_WITH(
+                monads::try_reduce(pool, numbers.begin(), numbers.end(), 0L, throwing_add, 1000),
+                "overflow"
+            );
+            REQUIRE(thrower != std::thread::id{ });
+            REQUIRE(thrower != std::this_thread::get_id());
+        }
+    }
+
+    WHEN("the range fits in a single chunk") {
+        const auto result = monads::try_reduce(pool, numbers.begin(), numbers.begin() + 10,
+                                               0L, checked_add);
+
+        THEN("it is reduced on the calling thread") {
+            REQUIRE(result.unwrap() == 55);
+            REQUIRE(calls == 10);
+        }
+    }
+}
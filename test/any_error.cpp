@@ -0,0 +1,200 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/any_error.hpp>
+
+#include "catch.hpp"
+
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <typeinfo>
+#include <utility>
+
+namespace {
+
+enum class Status {
+    NotFound,
+    Timeout
+};
+
+struct Large {
+    char message[64];
+
+    const char* what() const noexcept {
+        return message;
+    }
+};
+
+struct DerivedError : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+Large make_large(const char *message) {
+    Large large{ };
+    std::strncpy(large.message, message, sizeof(large.message) - 1);
+
+    return large;
+}
+
+} // namespace
+
+static_assert(sizeof(monads::AnyError) == 32 || sizeof(void*) != 8,
+              "AnyError must fit in half a cache line on 64-bit targets");
+
+SCENARIO(
+    "monads::AnyError",
+    "[monads][monads/any_error.hpp][monads::AnyError]"
+) {
+    GIVEN("an AnyError holding a small error") {
+        monads::AnyError error = monads::make_any_error<std::runtime_error>("disk full");
+
+        THEN("it is stored inline") {
+            using namespace std::literals;
+
+            REQUIRE(error.is_inline());
+            REQUIRE(error.what() == "disk full"s);
+            REQUIRE(error.type() == typeid(std::runtime_error));
+            REQUIRE(error.holds<std::runtime_error>());
+            REQUIRE(error.get_if<std::logic_error>() == nullptr);
+        }
+
+        WHEN("it is copied and moved") {
+            const monads::AnyError copy = error;
+            const monads::AnyError moved = std::move(error);
+
+            THEN("the copy holds the same error and the source is left empty") {
+                using namespace std::literals;
+
+                REQUIRE(copy.what() == "disk full"s);
+                REQUIRE(moved.get_if<std::runtime_error>() != nullptr);
+                REQUIRE(error.empty());
+            }
+        }
+    }
+
+    GIVEN("an AnyError holding an error without a what member") {
+        const auto error = monads::make_any_error<Status>(Status::Timeout);
+
+        THEN("the payload can be recovered by type") {
+            REQUIRE(error.is_inline());
+            REQUIRE(*error.get_if<Status>() == Status::Timeout);
+        }
+    }
+
+    GIVEN("an AnyError holding a payload larger than the inline buffer") {
+        monads::AnyError error = monads::make_any_error<Large>(make_large("too large"));
+
+        THEN("it falls back to the heap") {
+            using namespace std::literals;
+
+            REQUIRE_FALSE(error.is_inline());
+            REQUIRE(error.what() == "too large"s);
+
+            monads::AnyError copy;
+            copy = error;
+            error.get_if<Large>()->message[0] = 'T';
+
+            REQUIRE(copy.what() == "too large"s);
+            REQUIRE(error.what() == "Too large"s);
+        }
+    }
+}
+
+SCENARIO(
+    "monads::try_invoke with AnyError",
+    "[monads][monads/any_error.hpp][monads::AnyError][monads::try_invoke]"
+) {
+    WHEN("the callable returns normally") {
+        const auto result = monads::try_invoke<monads::AnyError>([] { return 42; });
+
+        THEN("the value is returned") {
+            REQUIRE(result.unwrap() == 42);
+        }
+    }
+
+    WHEN("the callable throws a standard exception") {
+        const auto result = monads::try_invoke<monads::AnyError>([]() -> int {
+            throw std::out_of_range{ "index 7" };
+        });
+
+        THEN("the exception is captured by value inline") {
+            using namespace std::literals;
+
+            REQUIRE(result.has_error());
+            REQUIRE(result.unwrap_error().is_inline());
+            REQUIRE(result.unwrap_error().holds<std::out_of_range>());
+            REQUIRE(result.unwrap_error().what() == "index 7"s);
+        }
+    }
+
+    WHEN("the callable throws a standard exception too large to be inline") {
+        const auto result = monads::try_invoke<monads::AnyError>([]() -> int {
+            throw std::system_error{ std::make_error_code(std::errc::timed_out), "connect" };
+        });
+
+        THEN("the exception is captured by value on the heap") {
+            const monads::AnyError &error = result.unwrap_error();
+
+            REQUIRE_FALSE(error.is_inline());
+            REQUIRE(error.get_if<std::system_error>()->code() == std::errc::timed_out);
+        }
+    }
+
+    WHEN("the callable throws a type derived from a standard exception") {
+        const auto result = monads::try_invoke<monads::AnyError>([]() -> int {
+            throw DerivedError{ "derived" };
+        });
+
+        THEN("the exception keeps its dynamic type in an exception_ptr") {
+            using namespace std::literals;
+
+            const monads::AnyError &error = result.unwrap_error();
+
+            REQUIRE(error.holds<std::exception_ptr>());
+            REQUIRE(error.what() == "derived"s);
+            REQUIRE_THROWS_AS(std::rethrow_exception(*error.get_if<std::exception_ptr>()),
+                              DerivedError);
+        }
+    }
+
+    WHEN("the callable throws something other than an exception") {
+        const auto result = monads::try_invoke<monads::AnyError>([]() -> int {
+            throw 5;
+        });
+
+        THEN("it is captured in an exception_ptr") {
+            REQUIRE(result.unwrap_error().holds<std::exception_ptr>());
+        }
+    }
+}
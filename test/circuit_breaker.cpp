@@ -0,0 +1,213 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/circuit_breaker.hpp>
+
+#include "catch.hpp"
+#include "manual_clock.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+using Clock = ManualClock<struct CircuitBreakerTag>;
+
+SCENARIO(
+    "monads::CircuitBreaker",
+    "[monads][monads/circuit_breaker.hpp][monads::CircuitBreaker]"
+) {
+    using std::chrono::seconds;
+
+    monads::CircuitBreakerOptions options;
+    options.failure_threshold = 0.5;
+    options.minimum_calls = 4;
+    options.window = seconds{ 10 };
+    options.buckets = 10;
+    options.open_duration = seconds{ 5 };
+
+    monads::CircuitBreaker<std::runtime_error, Clock> breaker{
+        std::runtime_error{ "circuit open" },
+        options
+    };
+
+    int calls = 0;
+    const auto fail = [&calls]() -> int {
+        ++calls;
+
+        throw std::runtime_error{ "downstream failed" };
+    };
+    const auto succeed = [&calls] {
+        ++calls;
+
+        return 42;
+    };
+
+    WHEN("the error rate stays below the threshold") {
+        for (int i = 0; i < 3; ++i) {
+            breaker(succeed);
+        }
+
+        for (int i = 0; i < 2; ++i) {
+            breaker(fail);
+        }
+
+        THEN("the circuit stays closed") {
+            REQUIRE(breaker.state() == monads::CircuitState::Closed);
+            REQUIRE(breaker(succeed).unwrap() == 42);
+            REQUIRE(calls == 6);
+        }
+    }
+
+    WHEN("the error rate exceeds the threshold") {
+        for (int i = 0; i < 2; ++i) {
+            breaker(succeed);
+            breaker(fail);
+        }
+
+        THEN("calls fail fast with the cached error") {
+            using namespace std::literals;
+
+            REQUIRE(breaker.state() == monads::CircuitState::Open);
+
+            const auto result = breaker(succeed);
+
+            REQUIRE(result.has_error());
+            REQUIRE(result.unwrap_error().what() == "circuit open"s);
+            REQUIRE(calls == 4);
+        }
+
+        THEN("a successful trial after the open duration closes it") {
+            Clock::advance(seconds{ 5 });
+
+            REQUIRE(breaker(succeed).unwrap() == 42);
+            REQUIRE(breaker.state() == monads::CircuitState::Closed);
+            REQUIRE(calls == 5);
+
+            breaker(fail);
+            REQUIRE(breaker.state() == monads::CircuitState::Closed);
+        }
+
+        THEN("a failed trial reopens it") {
+            Clock::advance(seconds{ 5 });
+
+            REQUIRE(breaker(fail).has_error());
+            REQUIRE(breaker.state() == monads::CircuitState::Open);
+
+            breaker(succeed);
+            REQUIRE(calls == 5);
+        }
+    }
+
+    WHEN("failures fall out of the sliding window") {
+        for (int i = 0; i < 3; ++i) {
+            breaker(fail);
+        }
+
+        Clock::advance(seconds{ 11 });
+        breaker(fail);
+
+        THEN("they no longer count towards the error rate") {
+            REQUIRE(breaker.state() == monads::CircuitState::Closed);
+        }
+    }
+}
+
+SCENARIO(
+    "monads::CircuitBreaker with a trial that throws an uncaught exception",
+    "[monads][monads/circuit_breaker.hpp][monads::CircuitBreaker]"
+) {
+    using std::chrono::seconds;
+
+    monads::CircuitBreakerOptions options;
+    options.minimum_calls = 1;
+    options.open_duration = seconds{ 5 };
+
+    monads::CircuitBreaker<std::string, Clock> breaker{ "circuit open", options };
+
+    const auto fail = []() -> int {
+        throw std::string{ "downstream failed" };
+    };
+    const auto escape = []() -> int {
+        throw std::runtime_error{ "not a std::string" };
+    };
+
+    breaker(fail);
+    REQUIRE(breaker.state() == monads::CircuitState::Open);
+
+    WHEN("the trial throws something other than the error type") {
+        Clock::advance(seconds{ 5 });
+
+        REQUIRE_THROWS_AS(breaker(escape), std::runtime_error);
+
+        THEN("the circuit reopens instead of staying half-open") {
+            REQUIRE(breaker.state() == monads::CircuitState::Open);
+
+            Clock::advance(seconds{ 5 });
+
+            REQUIRE(breaker([] { return 42; }).unwrap() == 42);
+            REQUIRE(breaker.state() == monads::CircuitState::Closed);
+        }
+    }
+}
+
+SCENARIO(
+    "monads::detail::WindowCounters",
+    "[monads][monads/detail/circuit_breaker.hpp][monads::detail::WindowCounters]"
+) {
+    GIVEN("a slot holding counts for a recent epoch") {
+        monads::detail::WindowCounters counters{ 1, 2 };
+
+        counters.record(4, false);
+        counters.record(4, false);
+
+        WHEN("a caller records an older epoch that maps to the same slot") {
+            counters.record(2, true);
+
+            THEN("the older sample is dropped and the recent counts are kept") {
+                const auto totals = counters.totals(4);
+
+                REQUIRE(totals.failures == 2);
+                REQUIRE(totals.successes == 0);
+            }
+        }
+
+        WHEN("a newer epoch maps to the same slot") {
+            counters.record(6, true);
+
+            THEN("the slot is reset for the newer epoch") {
+                const auto totals = counters.totals(6);
+
+                REQUIRE(totals.failures == 0);
+                REQUIRE(totals.successes == 1);
+            }
+        }
+    }
+}
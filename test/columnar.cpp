@@ -0,0 +1,253 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/columnar.hpp>
+
+#include "catch.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+enum class ErrorCode : std::uint16_t {
+    NotFound = 1,
+    Timeout = 2
+};
+
+struct TemporaryFile {
+    explicit TemporaryFile(const char *name) noexcept : path{ name } { }
+
+    ~TemporaryFile() {
+        std::remove(path);
+    }
+
+    const char *path;
+};
+
+void overwrite(const char *path, long offset, const void *data, std::size_t size) {
+    std::FILE *const file = std::fopen(path, "r+b");
+    std::fseek(file, offset, SEEK_SET);
+    std::fwrite(data, 1, size, file);
+    std::fclose(file);
+}
+
+} // namespace
+
+SCENARIO(
+    "monads::OptionalColumn",
+    "[monads][monads/columnar.hpp][monads::OptionalColumn]"
+) {
+    const TemporaryFile file{ "monads_optional_column.bin" };
+
+    GIVEN("a batch of optionals written to a column file") {
+        std::vector<monads::Optional<std::int64_t>> batch;
+
+        for (std::int64_t i = 0; i < 1000; ++i) {
+            if (i % 3 == 0) {
+                batch.emplace_back();
+            } else {
+                batch.emplace_back(i * i);
+            }
+        }
+
+        const auto written =
+            monads::write_optional_column(file.path, batch.data(), batch.size());
+
+        REQUIRE(written.has_value());
+
+        WHEN("it is mapped") {
+            auto column = monads::OptionalColumn<std::int64_t>::open(file.path);
+
+            THEN("every element reads back unchanged") {
+                REQUIRE(column.has_value());
+                REQUIRE(column->size() == batch.size());
+
+                for (std::size_t i = 0; i < batch.size(); ++i) {
+                    const monads::Optional<std::int64_t> element = (*column)[i];
+
+                    REQUIRE(element.has_value() == batch[i].has_value());
+                    REQUIRE(column->view(i).has_value() == batch[i].has_value());
+
+                    if (element.has_value()) {
+                        REQUIRE(*element == *batch[i]);
+                    }
+                }
+            }
+
+            THEN("the values column is aligned and zero-copy") {
+                const auto view = column->view(1);
+
+                REQUIRE(reinterpret_cast<std::uintptr_t>(&*view) % alignof(std::int64_t) == 0);
+                REQUIRE(*view == 1);
+            }
+        }
+
+        WHEN("it is mapped with the wrong payload type") {
+            const auto column = monads::OptionalColumn<std::int32_t>::open(file.path);
+
+            THEN("the layout mismatch is reported") {
+                REQUIRE(column.has_error());
+                REQUIRE(column.unwrap_error() == monads::ColumnarError::LayoutMismatch);
+            }
+        }
+
+        WHEN("its magic number is corrupted") {
+            const std::uint32_t magic = 0xdeadbeef;
+            overwrite(file.path, 0, &magic, sizeof(magic));
+
+            THEN("it is rejected") {
+                const auto column = monads::OptionalColumn<std::int64_t>::open(file.path);
+
+                REQUIRE(column.has_error());
+                REQUIRE(column.unwrap_error() == monads::ColumnarError::BadMagic);
+            }
+        }
+
+        WHEN("it is truncated") {
+            std::FILE *const truncated = std::fopen(file.path, "wb");
+            std::fwrite(batch.data(), 1, 16, truncated);
+            std::fclose(truncated);
+
+            THEN("it is rejected") {
+                const auto column = monads::OptionalColumn<std::int64_t>::open(file.path);
+
+                REQUIRE(column.has_error());
+                REQUIRE(column.unwrap_error() == monads::ColumnarError::Truncated);
+            }
+        }
+    }
+
+    WHEN("the file does not exist") {
+        const auto column = monads::OptionalColumn<std::int64_t>::open(file.path);
+
+        THEN("opening fails") {
+            REQUIRE(column.has_error());
+            REQUIRE(column.unwrap_error() == monads::ColumnarError::OpenFailed);
+        }
+    }
+}
+
+SCENARIO(
+    "monads::ExpectedColumn",
+    "[monads][monads/columnar.hpp][monads::ExpectedColumn]"
+) {
+    using Result = monads::Expected<double, ErrorCode>;
+
+    const TemporaryFile file{ "monads_expected_column.bin" };
+
+    GIVEN("a batch of expecteds with sparse errors written to a column file") {
+        std::vector<Result> batch;
+
+        for (int i = 0; i < 1000; ++i) {
+            if (i % 97 == 0) {
+                batch.emplace_back(monads::InPlaceErrorType{ },
+                                   i % 2 ? ErrorCode::Timeout : ErrorCode::NotFound);
+            } else {
+                batch.emplace_back(monads::InPlaceValueType{ }, i * 0.5);
+            }
+        }
+
+        REQUIRE(monads::write_expected_column(file.path, batch.data(), batch.size()));
+
+        WHEN("it is mapped") {
+            auto column = monads::ExpectedColumn<double, ErrorCode>::open(file.path);
+
+            THEN("every element reads back unchanged") {
+                REQUIRE(column.has_value());
+                REQUIRE(column->size() == batch.size());
+                REQUIRE(column->error_count() == 11);
+
+                for (std::size_t i = 0; i < batch.size(); ++i) {
+                    const Result element = (*column)[i];
+
+                    REQUIRE(element.has_value() == batch[i].has_value());
+
+                    if (element.has_value()) {
+                        REQUIRE(element.unwrap() == batch[i].unwrap());
+                    } else {
+                        REQUIRE(element.unwrap_error() == batch[i].unwrap_error());
+                    }
+                }
+            }
+
+            THEN("the column survives being moved") {
+                auto moved = std::move(column).unwrap();
+
+                REQUIRE(moved.view(97).has_error());
+                REQUIRE(moved.view(97).unwrap_error() == ErrorCode::Timeout);
+                REQUIRE(moved[98].unwrap() == 49.0);
+            }
+        }
+
+        WHEN("an error index no longer matches a cleared validity bit") {
+            const auto layout = monads::detail::column_layout(
+                batch.size(), sizeof(double), 11, sizeof(ErrorCode)
+            );
+            const std::uint64_t index = 1;
+            overwrite(file.path, static_cast<long>(layout.error_indices_offset),
+                      &index, sizeof(index));
+
+            THEN("it is rejected when opened") {
+                const auto column = monads::ExpectedColumn<double, ErrorCode>::open(file.path);
+
+                REQUIRE(column.has_error());
+                REQUIRE(column.unwrap_error() == monads::ColumnarError::BadErrorIndices);
+            }
+        }
+
+        WHEN("the error indices are out of order") {
+            const auto layout = monads::detail::column_layout(
+                batch.size(), sizeof(double), 11, sizeof(ErrorCode)
+            );
+            const std::uint64_t swapped[] = { 97, 0 };
+            overwrite(file.path, static_cast<long>(layout.error_indices_offset),
+                      swapped, sizeof(swapped));
+
+            THEN("it is rejected when opened") {
+                const auto column = monads::ExpectedColumn<double, ErrorCode>::open(file.path);
+
+                REQUIRE(column.has_error());
+                REQUIRE(column.unwrap_error() == monads::ColumnarError::BadErrorIndices);
+            }
+        }
+
+        WHEN("it is mapped as an optional column") {
+            const auto column = monads::OptionalColumn<double>::open(file.path);
+
+            THEN("the kind mismatch is reported") {
+                REQUIRE(column.has_error());
+                REQUIRE(column.unwrap_error() == monads::ColumnarError::LayoutMismatch);
+            }
+        }
+    }
+}
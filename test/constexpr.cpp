@@ -0,0 +1,246 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/expected.hpp>
+#include <monads/one_of.hpp>
+#include <monads/optional.hpp>
+
+#include "catch.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+constexpr std::size_t TABLE_SIZE = 256;
+
+struct Square {
+	constexpr int operator()(int x) const noexcept {
+		return x * x;
+	}
+};
+
+struct Negate {
+	constexpr int operator()(int x) const noexcept {
+		return -x;
+	}
+};
+
+struct Table {
+	monads::Optional<int> entries[TABLE_SIZE];
+};
+
+constexpr monads::Expected<int, int> checked_square(int x) noexcept {
+	monads::Expected<int, int> result = monads::make_expected<int, int>(0);
+
+	if (x % 3 == 0) {
+		result.emplace_error(x);
+
+		return result.map_error(Negate{ });
+	}
+
+	result.emplace(x);
+
+	return result.map(Square{ });
+}
+
+constexpr Table make_table() noexcept {
+	Table table{ };
+
+	for (std::size_t i = 0; i < TABLE_SIZE; ++i) {
+		const int x = static_cast<int>(i);
+		const monads::Expected<int, int> result = checked_square(x);
+		monads::Optional<int> entry;
+
+		if (result.has_error()) {
+			entry = monads::make_optional<int>(result.unwrap_error());
+		} else if (x % 5 != 0) {
+			entry.emplace(result.unwrap());
+		} else {
+			entry.emplace(result.unwrap());
+			entry.reset();
+		}
+
+		table.entries[i] = entry;
+	}
+
+	return table;
+}
+
+constexpr Table TABLE = make_table();
+
+constexpr bool table_is_correct() noexcept {
+	for (std::size_t i = 0; i < TABLE_SIZE; ++i) {
+		const int x = static_cast<int>(i);
+		const monads::Optional<int> &entry = TABLE.entries[i];
+
+		if (x % 3 == 0) {
+			if (!entry || *entry != -x) {
+				return false;
+			}
+		} else if (x % 5 == 0) {
+			if (entry) {
+				return false;
+			}
+		} else if (!entry || *entry != x * x) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static_assert(table_is_correct(), "TABLE must be computed at compile time");
+static_assert(*TABLE.entries[2] == 4, "TABLE[2] must contain 4");
+static_assert(*TABLE.entries[255] == -255, "TABLE[255] must contain -255");
+static_assert(!TABLE.entries[10], "TABLE[10] must be empty");
+
+static_assert(std::is_trivially_copyable<monads::Optional<int>>::value,
+			  "Optional<int> must be trivially copyable");
+static_assert(std::is_trivially_copyable<monads::Expected<int, int>>::value,
+			  "Expected<int, int> must be trivially copyable");
+static_assert(!std::is_trivially_copyable<monads::Optional<std::string>>::value,
+			  "Optional<std::string> must not be trivially copyable");
+static_assert(!std::is_copy_constructible<monads::Optional<std::unique_ptr<int>>>::value,
+			  "Optional<std::unique_ptr<int>> must not be copy constructible");
+static_assert(std::is_nothrow_move_constructible<
+	monads::Expected<std::unique_ptr<int>, std::string>
+>::value, "Expected<std::unique_ptr<int>, std::string> must be nothrow movable");
+
+enum class ParseError {
+	Malformed
+};
+
+enum class IoError {
+	Denied
+};
+
+using LayerError = monads::OneOf<ParseError, IoError>;
+
+constexpr int layered(int x) noexcept {
+	monads::Expected<int, LayerError> result{ monads::InPlaceValueType{ }, x };
+	const monads::Expected<int, LayerError> copy = result;
+
+	result.emplace_error(IoError::Denied);
+
+	monads::Expected<int, LayerError> assigned = copy;
+	assigned = result;
+
+	if (!copy.has_value() || !assigned.has_error()
+		|| !assigned.unwrap_error().holds<IoError>()) {
+		return -1;
+	}
+
+	assigned.emplace(copy.unwrap() + 1);
+
+	return assigned.unwrap();
+}
+
+#ifdef MONADS_HAS_ACTIVE_MEMBER_QUERY
+static_assert(layered(41) == 42, "an Expected with a OneOf error must be constexpr");
+
+static_assert(
+	monads::Expected<int, LayerError>{ monads::InPlaceErrorType{ }, ParseError::Malformed }
+		.unwrap_error().holds<ParseError>(),
+	"a merged Expected must report its state in a constant expression"
+);
+#endif
+
+#ifdef MONADS_HAS_CONSTEXPR_CONSTRUCT
+struct Boxed {
+	constexpr explicit Boxed(int x) noexcept : value{ new int(x) } { }
+
+	constexpr Boxed(const Boxed &other) noexcept : value{ new int(*other.value) } { }
+
+	constexpr Boxed& operator=(const Boxed &other) noexcept {
+		*value = *other.value;
+
+		return *this;
+	}
+
+	constexpr ~Boxed() {
+		delete value;
+	}
+
+	int *value;
+};
+
+constexpr int sum_boxed() noexcept {
+	monads::Optional<Boxed> maybe;
+	monads::Expected<Boxed, int> expected = monads::make_unexpected<Boxed, int>(0);
+	int sum = 0;
+
+	for (int i = 0; i < static_cast<int>(TABLE_SIZE); ++i) {
+		maybe.emplace(i);
+		expected.emplace(*maybe->value);
+
+		const monads::Optional<Boxed> copy = maybe;
+		const monads::Expected<Boxed, int> copied = expected;
+
+		sum += *copy->value + *copied->value;
+		expected = monads::make_unexpected<Boxed, int>(i);
+		maybe.reset();
+	}
+
+	return sum;
+}
+
+static_assert(sum_boxed() == 255 * 256, "non-trivial types must be constexpr in C++20");
+#endif
+
+} // namespace
+
+SCENARIO(
+	"constexpr Optional and Expected",
+	"[monads][monads/optional.hpp][monads/expected.hpp][constexpr]"
+) {
+	WHEN("an Expected with a OneOf error is used at runtime") {
+		THEN("it gives the same result as at compile time") {
+			REQUIRE(layered(41) == 42);
+		}
+	}
+
+	WHEN("a table is computed at compile time") {
+		THEN("it matches the table computed at runtime") {
+			const Table table = make_table();
+
+			for (std::size_t i = 0; i < TABLE_SIZE; ++i) {
+				REQUIRE(table.entries[i].has_value() == TABLE.entries[i].has_value());
+
+				if (table.entries[i]) {
+					REQUIRE(*table.entries[i] == *TABLE.entries[i]);
+				}
+			}
+		}
+	}
+}
@@ -35,9 +35,15 @@
 
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
 
 using namespace std::literals;
 
+static_assert(std::is_empty<monads::ErrorSite>::value,
+              "ErrorSite must be empty when instrumentation is disabled");
+
 class Identifier {
 public:
     constexpr explicit Identifier(int base) noexcept : base_{ base } { }
@@ -242,6 +248,20 @@ SCENARIO("monads::Expected", "[monads][monads/expected.hpp][monads::Expected]")
         }
     }
 
+    WHEN("Expected error forwarding ctors are used") {
+        static_assert(
+            std::is_convertible<const char*, monads::Expected<int, std::string>>::value,
+            ""
+        );
+
+        const monads::Expected<int, std::string> maybe_int = "oh no";
+
+        THEN("they construct an error") {
+            REQUIRE(maybe_int.has_error());
+            REQUIRE(maybe_int.unwrap_error() == "oh no");
+        }
+    }
+
     WHEN("try_invoke is used to catch an exception by value") {
         using namespace std::literals;
 
@@ -280,3 +300,23 @@ SCENARIO("monads::Expected", "[monads][monads/expected.hpp][monads::Expected]")
         }
     }
 }
+
+SCENARIO(
+    "monads::Expected<std::string, std::error_code>",
+    "[monads][monads/expected.hpp][monads::Expected]"
+) {
+    WHEN("the commonly instantiated specialization is used") {
+        monads::Expected<std::string, std::error_code> result{
+            monads::InPlaceErrorType{ },
+            std::make_error_code(std::errc::invalid_argument)
+        };
+
+        THEN("it works") {
+            REQUIRE(result.error() == std::errc::invalid_argument);
+
+            result.emplace("foo");
+
+            REQUIRE(result.value() == "foo");
+        }
+    }
+}
@@ -0,0 +1,173 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/expected.hpp>
+#include <monads/optional.hpp>
+
+#include "catch.hpp"
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+namespace {
+
+std::uint64_t count_at(int line, const std::type_info &type) {
+	std::uint64_t total = 0;
+
+	for (const monads::ErrorCount &each : monads::CounterSink::snapshot()) {
+		if (each.site.line == line && *each.error_type == type) {
+			total += each.count;
+		}
+	}
+
+	return total;
+}
+
+} // namespace
+
+SCENARIO(
+	"monads::CounterSink",
+	"[monads][monads/detail/instrumentation.hpp][monads::CounterSink]"
+) {
+	const auto fail = []() -> int {
+		throw std::runtime_error{ "failed" };
+	};
+	const auto succeed = [] {
+		return 42;
+	};
+
+	WHEN("try_invoke_at takes the error path") {
+		const int line = __LINE__ + 3;
+
+		for (int i = 0; i < 10; ++i) {
+			monads::try_invoke_at(monads::ErrorSite::current(), fail);
+			monads::try_invoke_at(monads::ErrorSite::current(), succeed);
+		}
+
+		THEN("each error is counted against its call site and error type") {
+			REQUIRE(count_at(line, typeid(std::exception_ptr)) == 10);
+			REQUIRE(count_at(line + 1, typeid(std::exception_ptr)) == 0);
+		}
+	}
+
+	WHEN("try_invoke_at catches a specific error type") {
+		const monads::ErrorSite site = monads::ErrorSite::current();
+		const auto result = monads::try_invoke_at<std::runtime_error>(site, fail);
+
+		THEN("the error type is recorded") {
+			REQUIRE(result.has_error());
+			REQUIRE(count_at(site.line, typeid(std::runtime_error)) == 1);
+			REQUIRE(std::string{ site.file }.find("instrumentation.cpp") != std::string::npos);
+		}
+	}
+
+	WHEN("maybe_invoke_at takes the error path") {
+		const monads::ErrorSite site = monads::ErrorSite::current();
+		const auto maybe = monads::maybe_invoke_at(site, fail);
+
+		THEN("it is recorded with an unknown error type") {
+			REQUIRE_FALSE(maybe.has_value());
+			REQUIRE(count_at(site.line, typeid(void)) == 1);
+		}
+	}
+
+	WHEN("plain try_invoke and maybe_invoke take the error path") {
+		const auto fail_with = [](int, int, int) -> int {
+			throw std::runtime_error{ "failed" };
+		};
+		const int line = __LINE__ + 2;
+
+		const auto result = monads::try_invoke(fail);
+		const auto with_args = monads::try_invoke<std::runtime_error>(fail_with, 1, 2, 3);
+		const auto maybe = monads::maybe_invoke(fail_with, 1, 2, 3);
+
+		THEN("each error is counted against the caller, not the library") {
+			REQUIRE(result.has_error());
+			REQUIRE(with_args.has_error());
+			REQUIRE_FALSE(maybe.has_value());
+			REQUIRE(count_at(line, typeid(std::exception_ptr)) == 1);
+			REQUIRE(count_at(line + 1, typeid(std::runtime_error)) == 1);
+			REQUIRE(count_at(line + 2, typeid(void)) == 1);
+
+			for (const monads::ErrorCount &each : monads::CounterSink::snapshot()) {
+				if (each.site.line == line) {
+					REQUIRE(std::string{ each.site.file }.find("instrumentation.cpp") != std::string::npos);
+				}
+			}
+		}
+	}
+
+	WHEN("MONADS_TRY_INVOKE and MONADS_MAYBE_INVOKE take the error path") {
+		const int line = __LINE__ + 2;
+
+		const auto result = MONADS_TRY_INVOKE(fail);
+		const auto maybe = MONADS_MAYBE_INVOKE(fail);
+
+		THEN("each error is counted against the caller") {
+			REQUIRE(result.has_error());
+			REQUIRE_FALSE(maybe.has_value());
+			REQUIRE(count_at(line, typeid(std::exception_ptr)) == 1);
+			REQUIRE(count_at(line + 1, typeid(void)) == 1);
+		}
+	}
+
+	WHEN("errors are recorded from several threads") {
+		const monads::ErrorSite site = monads::ErrorSite::current();
+		std::vector<std::thread> threads;
+
+		for (int i = 0; i < 4; ++i) {
+			threads.emplace_back([&site, &fail] {
+				for (int j = 0; j < 1000; ++j) {
+					monads::try_invoke_at(site, fail);
+				}
+			});
+		}
+
+		for (std::thread &thread : threads) {
+			thread.join();
+		}
+
+		THEN("the per-thread counters are merged when dumped") {
+			REQUIRE(count_at(site.line, typeid(std::exception_ptr)) == 4000);
+			REQUIRE(monads::CounterSink::dropped() == 0);
+
+			std::ostringstream os;
+			monads::CounterSink::dump(os);
+
+			REQUIRE(os.str().find(":" + std::to_string(site.line) + ": ") != std::string::npos);
+		}
+	}
+}
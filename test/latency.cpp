@@ -0,0 +1,156 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/latency.hpp>
+
+#include "catch.hpp"
+#include "manual_clock.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using Clock = ManualClock<struct LatencyTag>;
+
+SCENARIO(
+    "monads::LatencyHistogram",
+    "[monads][monads/latency.hpp][monads::LatencyHistogram]"
+) {
+    WHEN("values are bucketed") {
+        THEN("each bucket is within 1/16 of the value it contains") {
+            for (std::uint64_t value = 0; value < (std::uint64_t{ 1 } << 40);
+                 value = value * 3 / 2 + 1) {
+                const std::size_t bucket = monads::detail::latency_bucket(value);
+                const std::uint64_t floor = monads::LatencyHistogram::bucket_floor(bucket);
+
+                REQUIRE(floor <= value);
+                REQUIRE(value < monads::LatencyHistogram::bucket_floor(bucket + 1));
+                REQUIRE(value - floor <= value / 16);
+            }
+        }
+    }
+
+    WHEN("percentiles are computed") {
+        monads::LatencyHistogram histogram;
+
+        for (std::uint64_t i = 1; i <= 100; ++i) {
+            histogram.record(i * 1000);
+        }
+
+        THEN("they are accurate to the bucket width") {
+            REQUIRE(histogram.count() == 100);
+            REQUIRE(histogram.percentile(0.5) >= 50000);
+            REQUIRE(histogram.percentile(0.5) < 50000 + 50000 / 16);
+            REQUIRE(histogram.percentile(1.0) >= 100000);
+            REQUIRE(histogram.percentile(1.0) < 100000 + 100000 / 16);
+        }
+    }
+}
+
+SCENARIO(
+    "monads::LatencyRecorder",
+    "[monads][monads/latency.hpp][monads::LatencyRecorder]"
+) {
+    monads::LatencyRecorder<Clock> recorder{ 4 };
+
+    const auto fast_success = [] {
+        Clock::advance(std::chrono::microseconds{ 1 });
+
+        return 42;
+    };
+    const auto slow_failure = []() -> int {
+        Clock::advance(std::chrono::milliseconds{ 250 });
+
+        throw std::runtime_error{ "timed out" };
+    };
+
+    WHEN("successes and failures are timed") {
+        for (int i = 0; i < 10; ++i) {
+            REQUIRE(monads::timed_try_invoke(recorder, fast_success).unwrap() == 42);
+        }
+
+        REQUIRE(monads::timed_try_invoke<std::runtime_error>(recorder, slow_failure)
+                    .has_error());
+
+        THEN("they are recorded into separate histograms") {
+            const monads::LatencySnapshot snapshot = recorder.snapshot();
+
+            REQUIRE(snapshot.successes.count() == 10);
+            REQUIRE(snapshot.failures.count() == 1);
+            REQUIRE(snapshot.successes.percentile(0.99) < 1100);
+            REQUIRE(snapshot.failures.percentile(0.5) >= 250000000);
+        }
+    }
+
+    WHEN("latencies are recorded from several threads") {
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&recorder] {
+                for (int j = 0; j < 1000; ++j) {
+                    recorder.record(j % 2 == 0, 100);
+                }
+            });
+        }
+
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        THEN("the shards are merged on read") {
+            const monads::LatencySnapshot snapshot = recorder.snapshot();
+
+            REQUIRE(snapshot.successes.count() == 2000);
+            REQUIRE(snapshot.failures.count() == 2000);
+        }
+    }
+}
+
+#ifdef MONADS_HAS_TSC_CLOCK
+SCENARIO(
+    "monads::TscClock",
+    "[monads][monads/latency.hpp][monads::TscClock]"
+) {
+    WHEN("a sleep is timed with it") {
+        const monads::TscClock::time_point start = monads::TscClock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+        const monads::TscClock::duration elapsed = monads::TscClock::now() - start;
+
+        THEN("it agrees with the time slept") {
+            REQUIRE(elapsed >= std::chrono::milliseconds{ 19 });
+            REQUIRE(elapsed < std::chrono::seconds{ 2 });
+        }
+    }
+}
+#endif
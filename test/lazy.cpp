@@ -0,0 +1,134 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/lazy.hpp>
+
+#include "catch.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO(
+    "monads::LazyOptional",
+    "[monads][monads/lazy.hpp][monads::LazyOptional]"
+) {
+    WHEN("many threads race to initialize a LazyOptional") {
+        monads::LazyOptional<std::string> lazy;
+        std::atomic<int> calls{ 0 };
+        std::vector<const std::string*> seen(8);
+        std::vector<std::thread> threads;
+
+        REQUIRE_FALSE(lazy);
+        REQUIRE_THROWS_AS(lazy.value(), monads::BadOptionalAccess);
+
+        for (std::size_t i = 0; i < seen.size(); ++i) {
+            threads.emplace_back([&lazy, &calls, &seen, i] {
+                seen[i] = &lazy.get_or_init([&calls] {
+                    ++calls;
+                    std::this_thread::yield();
+
+                    return std::string{ "computed exactly once" };
+                });
+            });
+        }
+
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        THEN("the initializer runs exactly once") {
+            REQUIRE(calls == 1);
+            REQUIRE(lazy.has_value());
+            REQUIRE(*lazy == "computed exactly once");
+
+            for (const std::string *ptr : seen) {
+                REQUIRE(ptr == &lazy.unwrap());
+            }
+        }
+    }
+
+    WHEN("the initializer throws") {
+        monads::LazyOptional<int> lazy;
+
+        REQUIRE_THROWS_AS(
+            lazy.get_or_init([]() -> int { throw std::runtime_error{ "oh no" }; }),
+            std::runtime_error
+        );
+
+        THEN("a later call may initialize it") {
+            REQUIRE_FALSE(lazy.has_value());
+            REQUIRE(lazy.get_or_init([] { return 42; }) == 42);
+            REQUIRE(lazy.get_or_init([] { return 0; }) == 42);
+        }
+    }
+}
+
+SCENARIO(
+    "monads::LazyExpected",
+    "[monads][monads/lazy.hpp][monads::LazyExpected]"
+) {
+    WHEN("the initializer throws a captured exception") {
+        monads::LazyExpected<int, std::runtime_error> lazy;
+        int calls = 0;
+
+        const auto init = [&calls]() -> int {
+            ++calls;
+
+            throw std::runtime_error{ "oh no" };
+        };
+
+        const auto &first = lazy.get_or_init(init);
+        const auto &second = lazy.get_or_init(init);
+
+        THEN("the error is cached and the initializer runs once") {
+            REQUIRE(lazy.is_initialized());
+            REQUIRE(calls == 1);
+            REQUIRE(&first == &second);
+            REQUIRE(first.has_error());
+        }
+    }
+
+    WHEN("the initializer succeeds") {
+        monads::LazyExpected<std::string> lazy;
+
+        REQUIRE_FALSE(lazy.is_initialized());
+
+        const auto &result = lazy.get_or_init([] { return std::string{ "foo" }; });
+
+        THEN("the value is cached") {
+            REQUIRE(result.value() == "foo");
+            REQUIRE(lazy.unwrap().value() == "foo");
+        }
+    }
+}
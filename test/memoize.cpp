@@ -0,0 +1,136 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/memoize.hpp>
+
+#include "catch.hpp"
+#include "manual_clock.hpp"
+
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+using Clock = ManualClock<struct MemoizeTag>;
+
+SCENARIO(
+    "monads::MemoizedInvoker",
+    "[monads][monads/memoize.hpp][monads::MemoizedInvoker]"
+) {
+    WHEN("a pure function is memoized") {
+        int calls = 0;
+        auto length = monads::memoize([&calls](const std::string &str) {
+            ++calls;
+
+            return str.size();
+        });
+
+        const auto first = length("foo");
+        const auto second = length(std::string{ "foo" });
+        const auto third = length("quux");
+
+        THEN("it is only invoked once per distinct argument") {
+            REQUIRE(calls == 2);
+            REQUIRE(first->value() == 3);
+            REQUIRE(third->value() == 4);
+        }
+
+        THEN("hits return the cached Expected without copying it") {
+            REQUIRE(first.get() == second.get());
+        }
+
+        THEN("hits and misses are counted per shard") {
+            const auto stats = length.stats();
+            const auto hits = std::accumulate(
+                stats.begin(), stats.end(), std::size_t{ 0 },
+                [](std::size_t sum, monads::MemoizeStats s) { return sum + s.hits; }
+            );
+            const auto misses = std::accumulate(
+                stats.begin(), stats.end(), std::size_t{ 0 },
+                [](std::size_t sum, monads::MemoizeStats s) { return sum + s.misses; }
+            );
+
+            REQUIRE(stats.size() == monads::MemoizeOptions{ }.shards);
+            REQUIRE(hits == 1);
+            REQUIRE(misses == 2);
+        }
+    }
+
+    WHEN("a memoized function throws") {
+        int calls = 0;
+        const auto fail = [&calls](int) -> int {
+            ++calls;
+
+            throw std::runtime_error{ "nope" };
+        };
+
+        monads::MemoizedInvoker<decltype(fail), std::runtime_error> uncached{ fail };
+        monads::MemoizedInvoker<decltype(fail), std::runtime_error> cached{
+            fail,
+            monads::MemoizeOptions{ 4, true, std::chrono::nanoseconds::zero() }
+        };
+
+        THEN("errors are only cached when negative caching is enabled") {
+            REQUIRE(uncached(0)->has_error());
+            REQUIRE(uncached(0)->has_error());
+            REQUIRE(calls == 2);
+
+            REQUIRE(cached(0)->has_error());
+            REQUIRE(cached(0)->has_error());
+            REQUIRE(calls == 3);
+        }
+    }
+
+    WHEN("a TTL is set") {
+        int calls = 0;
+        const auto square = [&calls](int x) {
+            ++calls;
+
+            return x * x;
+        };
+
+        monads::MemoizedInvoker<decltype(square), std::exception_ptr, Clock> memo{
+            square,
+            monads::MemoizeOptions{ 1, false, std::chrono::seconds{ 1 } }
+        };
+
+        THEN("entries expire after it elapses") {
+            REQUIRE(memo(3)->value() == 9);
+            Clock::advance(std::chrono::milliseconds{ 999 });
+            REQUIRE(memo(3)->value() == 9);
+            REQUIRE(calls == 1);
+
+            Clock::advance(std::chrono::milliseconds{ 1 });
+            REQUIRE(memo(3)->value() == 9);
+            REQUIRE(calls == 2);
+        }
+    }
+}
@@ -0,0 +1,62 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "catch.hpp"
+
+#include <stdexcept>
+#include <string>
+
+import monads;
+
+SCENARIO(
+	"import monads",
+	"[monads][monads.cppm]"
+) {
+	WHEN("the module is imported instead of the headers") {
+		const auto doubled = monads::try_invoke([] { return 21; })
+			.map([](int x) { return x * 2; });
+		const auto failed = monads::try_invoke<std::runtime_error>([]() -> int {
+			throw std::runtime_error{ "failed" };
+		});
+		const auto maybe = monads::maybe_invoke([] { return std::string{ "foo" }; });
+
+		THEN("Optional, Expected and ExceptionPtr are exported") {
+			using namespace std::literals;
+
+			REQUIRE(doubled.unwrap() == 42);
+			REQUIRE(failed.has_error());
+			REQUIRE(failed.unwrap_error().what() == "failed"s);
+			REQUIRE(*maybe == "foo");
+			REQUIRE(monads::make_optional<int>(3).value() == 3);
+			REQUIRE(monads::make_unexpected<int, int>(5).error() == 5);
+		}
+	}
+}
@@ -0,0 +1,227 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/one_of.hpp>
+
+#include "catch.hpp"
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+enum class ParseError {
+    Empty,
+    Malformed
+};
+
+enum class IoError {
+    NotFound,
+    Denied
+};
+
+enum class DbError {
+    Timeout
+};
+
+using AnyLayerError = monads::OneOf<ParseError, IoError, DbError>;
+
+monads::Expected<int, ParseError> parse(int input) {
+    if (input < 0) {
+        return { ParseError::Malformed };
+    }
+
+    return { input };
+}
+
+monads::Expected<int, AnyLayerError> load(int input) {
+    if (input == 0) {
+        return { IoError::NotFound };
+    }
+
+    return parse(input);
+}
+
+struct Describe {
+    std::string operator()(ParseError) const {
+        return "parse";
+    }
+
+    std::string operator()(IoError) const {
+        return "io";
+    }
+
+    std::string operator()(DbError) const {
+        return "db";
+    }
+};
+
+} // namespace
+
+#ifdef MONADS_HAS_ACTIVE_MEMBER_QUERY
+static_assert(
+    sizeof(monads::Expected<int, AnyLayerError>) == 2 * sizeof(int),
+    "the OneOf tag shares a byte with the Expected state"
+);
+
+static_assert(
+    sizeof(monads::Expected<int, AnyLayerError>)
+    < sizeof(monads::detail::ExpectedStorage<int, AnyLayerError>),
+    "a merged Expected is smaller than one with a separate state"
+);
+#endif
+
+static_assert(
+    std::is_trivially_copyable<monads::Expected<int, AnyLayerError>>::value,
+    "trivial alternatives keep the Expected trivially copyable"
+);
+
+SCENARIO(
+    "monads::OneOf",
+    "[monads][monads/one_of.hpp][monads::OneOf]"
+) {
+    GIVEN("a OneOf holding one of its alternatives") {
+        AnyLayerError error = IoError::Denied;
+
+        THEN("it reports which alternative it holds") {
+            REQUIRE(error.index() == 1);
+            REQUIRE(error.holds<IoError>());
+            REQUIRE_FALSE(error.holds<ParseError>());
+            REQUIRE(error.unwrap<IoError>() == IoError::Denied);
+        }
+
+        THEN("visit invokes the overload for the held alternative") {
+            REQUIRE(error.visit(Describe{ }) == "io");
+        }
+
+        WHEN("another alternative is assigned") {
+            error = DbError::Timeout;
+
+            THEN("the OneOf holds the new alternative") {
+                const AnyLayerError &view = error;
+
+                REQUIRE(view.holds<DbError>());
+                REQUIRE(view.visit(Describe{ }) == "db");
+            }
+        }
+
+        WHEN("it is widened to a OneOf with more alternatives") {
+            const monads::OneOf<IoError, ParseError> narrow = ParseError::Empty;
+            const AnyLayerError wide = narrow;
+
+            THEN("the held alternative is preserved") {
+                REQUIRE(wide.holds<ParseError>());
+                REQUIRE(wide.unwrap<ParseError>() == ParseError::Empty);
+            }
+        }
+    }
+
+    GIVEN("a OneOf with non-trivial alternatives") {
+        using Error = monads::OneOf<std::string, int>;
+
+        Error error = std::string{ "connection reset" };
+        const Error copy = error;
+
+        error = 42;
+
+        THEN("copies and assignments manage the alternatives") {
+            REQUIRE(copy.unwrap<std::string>() == "connection reset");
+            REQUIRE(error.unwrap<int>() == 42);
+
+            error = copy;
+            REQUIRE(std::move(error).unwrap<std::string>() == "connection reset");
+        }
+    }
+}
+
+SCENARIO(
+    "monads::Expected with a OneOf error",
+    "[monads][monads/one_of.hpp][monads::OneOf][monads::Expected]"
+) {
+    GIVEN("an Expected returned from a lower layer") {
+        THEN("a value passes through unchanged") {
+            const auto loaded = load(7);
+
+            REQUIRE(loaded.has_value());
+            REQUIRE(loaded.unwrap() == 7);
+        }
+
+        THEN("its error is widened into the OneOf") {
+            const auto loaded = load(-1);
+
+            REQUIRE(loaded.has_error());
+            REQUIRE(loaded.unwrap_error().holds<ParseError>());
+            REQUIRE(loaded.unwrap_error().unwrap<ParseError>() == ParseError::Malformed);
+        }
+
+        THEN("errors from the current layer are held alongside") {
+            const auto loaded = load(0);
+
+            REQUIRE(loaded.unwrap_error().visit(Describe{ }) == "io");
+        }
+    }
+
+    GIVEN("an Expected that is reassigned between states") {
+        monads::Expected<std::string, monads::OneOf<ParseError, IoError>> result{
+            monads::InPlaceErrorType{ },
+            IoError::Denied
+        };
+
+        result.emplace("value");
+
+        THEN("the state follows the last assignment") {
+            REQUIRE(result.has_value());
+            REQUIRE(result.unwrap() == "value");
+
+            result = monads::make_unexpected<std::string, monads::OneOf<ParseError, IoError>>(
+                ParseError::Empty
+            );
+
+            REQUIRE(result.has_error());
+            REQUIRE(result.unwrap_error().holds<ParseError>());
+        }
+    }
+
+    GIVEN("a non-const Expected lvalue with a OneOf error") {
+        monads::Expected<int, AnyLayerError> result = load(0);
+
+        WHEN("it is copied and moved") {
+            monads::Expected<int, AnyLayerError> copy = result;
+            const monads::Expected<int, AnyLayerError> moved = std::move(copy);
+
+            THEN("the error is preserved") {
+                REQUIRE(result.unwrap_error().holds<IoError>());
+                REQUIRE(moved.unwrap_error().unwrap<IoError>() == IoError::NotFound);
+            }
+        }
+    }
+}
@@ -0,0 +1,215 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/parse.hpp>
+
+#include "catch.hpp"
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+namespace {
+
+struct Field {
+    monads::StringView key;
+    std::uint64_t value;
+};
+
+bool is_key_char(char c) noexcept {
+    return (c >= 'a' && c <= 'z') || c == '_';
+}
+
+auto field_parser() {
+    namespace parse = monads::parse;
+
+    return parse::map(
+        parse::sequence(
+            parse::take_while1(is_key_char, "key"),
+            parse::character('=', "'='"),
+            parse::unsigned_integer<std::uint64_t>()
+        ),
+        [](std::tuple<monads::StringView, char, std::uint64_t> parsed) {
+            return Field{ std::get<0>(parsed), std::get<2>(parsed) };
+        }
+    );
+}
+
+} // namespace
+
+SCENARIO(
+    "monads::parse::sequence and monads::parse::map",
+    "[monads][monads/parse.hpp][monads::parse::sequence][monads::parse::map]"
+) {
+    const auto parser = field_parser();
+
+    GIVEN("a well-formed field") {
+        const std::string input = "retries=42;rest";
+        const auto result = parser(input.c_str());
+
+        THEN("the field is parsed and the remainder returned") {
+            REQUIRE(result.has_value());
+            REQUIRE(result.unwrap().first.key == "retries");
+            REQUIRE(result.unwrap().first.value == 42);
+            REQUIRE(result.unwrap().second == ";rest");
+        }
+
+        THEN("the key points into the input") {
+            REQUIRE(result.unwrap().first.key.data() == input.c_str());
+        }
+    }
+
+    GIVEN("a field missing its separator") {
+        const std::string input = "retries:42";
+        const auto result = parser(input.c_str());
+
+        THEN("the error points at the offending character") {
+            REQUIRE(result.has_error());
+            REQUIRE(result.unwrap_error().position == input.c_str() + 7);
+            REQUIRE(result.unwrap_error().expected == std::string{ "'='" });
+        }
+    }
+
+    GIVEN("a value that overflows") {
+        const auto result = parser("retries=18446744073709551616");
+
+        THEN("it is rejected") {
+            REQUIRE(result.has_error());
+            REQUIRE(result.unwrap_error().expected == std::string{ "unsigned integer" });
+        }
+    }
+}
+
+SCENARIO(
+    "monads::parse::alternative",
+    "[monads][monads/parse.hpp][monads::parse::alternative]"
+) {
+    namespace parse = monads::parse;
+
+    const auto parser = parse::alternative(
+        parse::literal("true", "boolean"),
+        parse::literal("false", "boolean"),
+        parse::map(
+            parse::sequence(parse::literal("no", "no"), parse::literal("ne", "none")),
+            [](std::tuple<monads::StringView, monads::StringView> parsed) {
+                return std::get<1>(parsed);
+            }
+        ),
+        parse::literal("null", "null")
+    );
+
+    WHEN("the first alternative matches") {
+        THEN("it is returned") {
+            REQUIRE(parse::alternative(parse::literal("a"), parse::literal("ab"))("ab")
+                        .unwrap().second == "b");
+        }
+    }
+
+    WHEN("a later alternative matches") {
+        const auto result = parse::alternative(
+            parse::literal("true", "boolean"),
+            parse::literal("null", "null")
+        )("null");
+
+        THEN("it is returned") {
+            REQUIRE(result.has_value());
+            REQUIRE(result.unwrap().first == "null");
+        }
+    }
+
+    WHEN("no alternative matches") {
+        const std::string input = "nothing";
+        const auto result = parser(input.c_str());
+
+        THEN("the error that got furthest is reported") {
+            REQUIRE(result.has_error());
+            REQUIRE(result.unwrap_error().position == input.c_str() + 2);
+            REQUIRE(result.unwrap_error().expected == std::string{ "none" });
+        }
+    }
+}
+
+SCENARIO(
+    "monads::parse::many and monads::parse::fold_many",
+    "[monads][monads/parse.hpp][monads::parse::many][monads::parse::fold_many]"
+) {
+    namespace parse = monads::parse;
+
+    const auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+    const auto digit = parse::satisfy(is_digit, "digit");
+
+    WHEN("many consumes repeated matches") {
+        const auto result = parse::many(digit)("123abc");
+
+        THEN("the matched span is returned without copying") {
+            REQUIRE(result.has_value());
+            REQUIRE(result.unwrap().first == "123");
+            REQUIRE(result.unwrap().second == "abc");
+        }
+    }
+
+    WHEN("many matches nothing") {
+        const auto result = parse::many(digit)("abc");
+
+        THEN("it succeeds with an empty span") {
+            REQUIRE(result.has_value());
+            REQUIRE(result.unwrap().first.empty());
+            REQUIRE(result.unwrap().second == "abc");
+        }
+    }
+
+    WHEN("the repeated parser does not consume input") {
+        const auto result = parse::many(parse::take_while(is_digit))("abc");
+
+        THEN("the loop terminates") {
+            REQUIRE(result.has_value());
+            REQUIRE(result.unwrap().second == "abc");
+        }
+    }
+
+    WHEN("fold_many sums fields") {
+        const auto sum = parse::fold_many(
+            parse::map(
+                parse::sequence(field_parser(), parse::character(';')),
+                [](std::tuple<Field, char> parsed) { return std::get<0>(parsed).value; }
+            ),
+            std::uint64_t{ 0 },
+            [](std::uint64_t total, std::uint64_t value) { return total + value; }
+        );
+        const auto result = sum("a=1;b=2;c=3;d=");
+
+        THEN("every complete field is accumulated") {
+            REQUIRE(result.has_value());
+            REQUIRE(result.unwrap().first == 6);
+            REQUIRE(result.unwrap().second == "d=");
+        }
+    }
+}
@@ -0,0 +1,235 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/ranges.hpp>
+
+#include <monads/expected.hpp>
+#include <monads/optional.hpp>
+
+#include "catch.hpp"
+
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef MONADS_HAS_RANGES
+#include <ranges>
+#endif
+
+namespace {
+
+using Result = monads::Expected<int, std::string>;
+
+std::vector<Result> make_results() {
+    std::vector<Result> results;
+
+    for (int i = 0; i < 10; ++i) {
+        if (i % 3 == 0) {
+            results.emplace_back(monads::InPlaceErrorType{ }, "bad " + std::to_string(i));
+        } else {
+            results.emplace_back(monads::InPlaceValueType{ }, i);
+        }
+    }
+
+    return results;
+}
+
+} // namespace
+
+SCENARIO(
+    "monads::values and monads::errors",
+    "[monads][monads/ranges.hpp][monads::values][monads::errors]"
+) {
+    GIVEN("a vector of Expecteds") {
+        std::vector<Result> results = make_results();
+
+        WHEN("its values are iterated") {
+            std::vector<int> seen;
+
+            for (int &value : results | monads::values()) {
+                seen.push_back(value);
+                value *= 10;
+            }
+
+            THEN("only the values are visited, by reference") {
+                REQUIRE(seen == (std::vector<int>{ 1, 2, 4, 5, 7, 8 }));
+                REQUIRE(results[1].unwrap() == 10);
+            }
+        }
+
+        WHEN("its errors are iterated") {
+            std::vector<std::string> seen;
+
+            for (const std::string &error : monads::errors(results)) {
+                seen.push_back(error);
+            }
+
+            THEN("only the errors are visited") {
+                REQUIRE(seen == (std::vector<std::string>{ "bad 0", "bad 3", "bad 6", "bad 9" }));
+            }
+        }
+
+        WHEN("its values are iterated backwards") {
+            const auto view = monads::values(results);
+            std::vector<int> seen(std::make_reverse_iterator(view.end()),
+                                  std::make_reverse_iterator(view.begin()));
+
+            THEN("the values are visited in reverse") {
+                REQUIRE(seen == (std::vector<int>{ 8, 7, 5, 4, 2, 1 }));
+            }
+        }
+    }
+
+    GIVEN("a temporary vector of Optionals") {
+        const auto view = std::vector<monads::Optional<int>>{ 1, { }, 3 } | monads::values();
+
+        THEN("the view owns the vector") {
+            REQUIRE(std::vector<int>(view.begin(), view.end()) == (std::vector<int>{ 1, 3 }));
+        }
+    }
+}
+
+SCENARIO(
+    "monads::filter_map",
+    "[monads][monads/ranges.hpp][monads::filter_map]"
+) {
+    GIVEN("a vector of ints") {
+        const std::vector<int> numbers{ 1, 2, 3, 4, 5, 6 };
+        int calls = 0;
+
+        const auto halves = numbers | monads::filter_map([&calls](int x) {
+            ++calls;
+
+            return x % 2 == 0 ? monads::make_optional<int>(x / 2) : monads::Optional<int>{ };
+        });
+
+        WHEN("it is filter-mapped") {
+            const std::vector<int> seen(halves.begin(), halves.end());
+
+            THEN("only the engaged results are kept") {
+                REQUIRE(seen == (std::vector<int>{ 1, 2, 3 }));
+            }
+
+            THEN("the callable is invoked once per element") {
+                REQUIRE(calls == 6);
+            }
+        }
+    }
+}
+
+SCENARIO(
+    "monads::transform_expected",
+    "[monads][monads/ranges.hpp][monads::transform_expected]"
+) {
+    GIVEN("a vector of Expecteds") {
+        const std::vector<Result> results = make_results();
+
+        const auto doubled = monads::transform_expected(results, [](int x) { return x * 2.5; });
+
+        THEN("values are transformed and errors pass through") {
+            REQUIRE(doubled.begin()[1].unwrap() == 2.5);
+            REQUIRE(doubled.begin()[3].unwrap_error() == "bad 3");
+        }
+
+        THEN("the iterators are random access input iterators") {
+            using Iterator = decltype(doubled.begin());
+
+            static_assert(std::is_same<
+                std::iterator_traits<Iterator>::iterator_category,
+                std::input_iterator_tag
+            >::value, "transform_expected yields prvalues, so its category is input");
+            static_assert(std::is_same<
+                Iterator::iterator_concept,
+                std::random_access_iterator_tag
+            >::value, "transform_expected must preserve random access traversal");
+
+            REQUIRE(doubled.end() - doubled.begin() == 10);
+            REQUIRE(doubled.size() == 10);
+            REQUIRE((*(doubled.begin() + 8)).unwrap() == 20.0);
+        }
+
+        THEN("the transformed values can be extracted") {
+            const auto extracted = doubled | monads::values();
+            using Iterator = decltype(extracted.begin());
+
+            static_assert(std::is_same<
+                std::iterator_traits<Iterator>::iterator_category,
+                std::input_iterator_tag
+            >::value, "values() over prvalues yields prvalues, so its category is input");
+            static_assert(std::is_same<
+                Iterator::iterator_concept,
+                std::bidirectional_iterator_tag
+            >::value, "values() must preserve bidirectional traversal");
+
+            std::vector<double> seen;
+
+            for (const double value : extracted) {
+                seen.push_back(value);
+            }
+
+            REQUIRE(seen == (std::vector<double>{ 2.5, 5, 10, 12.5, 17.5, 20 }));
+        }
+    }
+}
+
+#ifdef MONADS_HAS_RANGES
+SCENARIO(
+    "monads range adaptors with std::ranges",
+    "[monads][monads/ranges.hpp][std::ranges]"
+) {
+    std::vector<Result> results = make_results();
+
+    static_assert(std::ranges::view<monads::ValuesView<std::vector<Result>&>>,
+                  "values() must be a view");
+    static_assert(std::ranges::bidirectional_range<monads::ValuesView<std::vector<Result>&>>,
+                  "values() must preserve bidirectional iteration");
+
+    const auto doubled = monads::transform_expected(results, [](int x) { return x * 2; });
+
+    static_assert(std::ranges::random_access_range<decltype(doubled)>,
+                  "transform_expected must preserve random access");
+
+    WHEN("the adaptors are composed with standard views") {
+        auto first_two = results | monads::values() | std::views::take(2);
+        std::vector<int> seen;
+
+        for (const int value : first_two) {
+            seen.push_back(value);
+        }
+
+        THEN("they behave like any other view") {
+            REQUIRE(seen == (std::vector<int>{ 1, 2 }));
+            REQUIRE(std::ranges::distance(results | std::views::reverse | monads::errors()) == 4);
+        }
+    }
+}
+#endif
@@ -0,0 +1,198 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/optional.hpp>
+#include <monads/retry.hpp>
+
+#include "catch.hpp"
+#include "manual_clock.hpp"
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using Clock = ManualClock<struct RetryTag>;
+
+namespace {
+
+struct RecordingSleeper {
+    void operator()(std::chrono::nanoseconds duration) {
+        sleeps.push_back(duration);
+        Clock::advance(duration);
+    }
+
+    std::vector<std::chrono::nanoseconds> sleeps;
+};
+
+} // namespace
+
+SCENARIO("monads::retry", "[monads][monads/retry.hpp][monads::retry]") {
+    using std::chrono::milliseconds;
+    using Expected = monads::Expected<int, std::string>;
+
+    monads::RetryPolicy<std::string> policy;
+    policy.max_attempts = 4;
+    policy.initial_backoff = milliseconds{ 10 };
+    policy.max_backoff = milliseconds{ 25 };
+
+    std::minstd_rand engine;
+    RecordingSleeper sleeper;
+    int calls = 0;
+
+    WHEN("an operation fails transiently") {
+        const auto result = monads::retry(policy, [&calls] {
+            return ++calls < 3 ? monads::make_unexpected<int, std::string>("busy")
+                               : monads::make_expected<int, std::string>(calls);
+        }, sleeper, engine);
+
+        THEN("it is retried with exponential backoff until it succeeds") {
+            REQUIRE(result.value() == 3);
+            REQUIRE(sleeper.sleeps == std::vector<std::chrono::nanoseconds>{
+                milliseconds{ 10 },
+                milliseconds{ 20 }
+            });
+        }
+    }
+
+    WHEN("an operation keeps failing") {
+        const auto result = monads::retry(policy, [&calls] {
+            ++calls;
+
+            return monads::make_unexpected<int, std::string>("busy");
+        }, sleeper, engine);
+
+        THEN("the backoff is capped and the last error is returned") {
+            REQUIRE(calls == 4);
+            REQUIRE(result.error() == "busy");
+            REQUIRE(sleeper.sleeps == std::vector<std::chrono::nanoseconds>{
+                milliseconds{ 10 },
+                milliseconds{ 20 },
+                milliseconds{ 25 }
+            });
+        }
+    }
+
+    WHEN("the classifier rejects an error") {
+        policy.is_retryable = [](const std::string &err) { return err != "fatal"; };
+
+        const auto result = monads::retry(policy, [&calls] {
+            ++calls;
+
+            return monads::make_unexpected<int, std::string>("fatal");
+        }, sleeper, engine);
+
+        THEN("it is not retried") {
+            REQUIRE(calls == 1);
+            REQUIRE(sleeper.sleeps.empty());
+            REQUIRE(result.error() == "fatal");
+        }
+    }
+
+    WHEN("jitter is enabled") {
+        policy.jitter = 0.5;
+
+        monads::retry(policy, [&calls]() -> Expected {
+            ++calls;
+
+            return monads::make_unexpected<int, std::string>("busy");
+        }, sleeper, engine);
+
+        THEN("each delay is shortened by at most the jitter fraction") {
+            REQUIRE(sleeper.sleeps.size() == 3);
+            REQUIRE(sleeper.sleeps[0] <= milliseconds{ 10 });
+            REQUIRE(sleeper.sleeps[0] >= milliseconds{ 5 });
+            REQUIRE(sleeper.sleeps[2] <= milliseconds{ 25 });
+            REQUIRE(sleeper.sleeps[2] >= milliseconds{ 12 });
+        }
+    }
+
+    WHEN("retry_async is driven by a timer wheel") {
+        monads::TimerWheel<Clock> wheel{ milliseconds{ 1 } };
+        monads::Optional<int> completed;
+
+        monads::retry_async(wheel, policy, [&calls] {
+            return ++calls < 3 ? monads::make_unexpected<int, std::string>("busy")
+                               : monads::make_expected<int, std::string>(calls);
+        }, [&completed](Expected result) {
+            completed.emplace(result.value());
+        }, engine);
+
+        THEN("attempts are rescheduled instead of blocking") {
+            REQUIRE(calls == 1);
+            REQUIRE(wheel.pending() == 1);
+
+            Clock::advance(milliseconds{ 9 });
+            REQUIRE(wheel.run_expired() == 0);
+            REQUIRE(calls == 1);
+
+            Clock::advance(milliseconds{ 1 });
+            REQUIRE(wheel.run_expired() == 1);
+            REQUIRE(calls == 2);
+            REQUIRE_FALSE(completed);
+
+            Clock::advance(milliseconds{ 20 });
+            REQUIRE(wheel.run_expired() == 1);
+            REQUIRE(calls == 3);
+            REQUIRE(wheel.pending() == 0);
+            REQUIRE(completed);
+            REQUIRE(*completed == 3);
+        }
+    }
+}
+
+SCENARIO(
+    "monads::TimerWheel",
+    "[monads][monads/retry.hpp][monads::TimerWheel]"
+) {
+    using std::chrono::milliseconds;
+
+    WHEN("timers are scheduled further out than one revolution") {
+        monads::TimerWheel<Clock> wheel{ milliseconds{ 1 }, 8 };
+        std::vector<int> fired;
+
+        wheel.schedule_after(milliseconds{ 3 }, [&fired] { fired.push_back(3); });
+        wheel.schedule_after(milliseconds{ 11 }, [&fired] { fired.push_back(11); });
+
+        THEN("each fires only once its own deadline passes") {
+            Clock::advance(milliseconds{ 3 });
+            REQUIRE(wheel.run_expired() == 1);
+            REQUIRE(fired == std::vector<int>{ 3 });
+
+            Clock::advance(milliseconds{ 7 });
+            REQUIRE(wheel.run_expired() == 0);
+
+            Clock::advance(milliseconds{ 100 });
+            REQUIRE(wheel.run_expired() == 1);
+            REQUIRE(fired == (std::vector<int>{ 3, 11 }));
+        }
+    }
+}
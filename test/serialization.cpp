@@ -0,0 +1,185 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/serialization.hpp>
+
+#include "catch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <utility>
+
+namespace {
+
+struct Row {
+    std::int64_t id;
+    double score;
+    char tag[4];
+};
+
+enum class ErrorCode : std::uint16_t {
+    NotFound = 404,
+    Internal = 500
+};
+
+struct alignas(16) Buffer {
+    unsigned char bytes[256];
+};
+
+} // namespace
+
+SCENARIO(
+    "monads::serialize",
+    "[monads][monads/serialization.hpp][monads::serialize]"
+) {
+    Buffer buffer{ };
+
+    WHEN("an Expected value is round tripped") {
+        const auto expected = monads::make_expected<Row, ErrorCode>(Row{ 7, 0.5, "abc" });
+        const auto written = monads::serialize(expected, buffer.bytes, sizeof(buffer.bytes));
+
+        THEN("the view references the payload in place") {
+            REQUIRE(written.has_value());
+            REQUIRE(written.unwrap() == monads::serialized_size(expected));
+
+            const auto view = monads::view_expected<Row, ErrorCode>(buffer.bytes,
+                                                                    written.unwrap());
+
+            REQUIRE(view.has_value());
+            REQUIRE(view.unwrap().has_value());
+            REQUIRE(view.unwrap()->id == 7);
+            REQUIRE(view.unwrap()->score == 0.5);
+            REQUIRE(std::strcmp(view.unwrap()->tag, "abc") == 0);
+            REQUIRE(reinterpret_cast<const unsigned char*>(&view.unwrap().unwrap())
+                    >= buffer.bytes);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(&view.unwrap().unwrap())
+                    % alignof(Row) == 0);
+        }
+    }
+
+    WHEN("an Expected error is round tripped") {
+        const auto expected = monads::make_unexpected<Row, ErrorCode>(ErrorCode::NotFound);
+        const auto written = monads::serialize(expected, buffer.bytes, sizeof(buffer.bytes));
+        const auto view = monads::view_expected<Row, ErrorCode>(buffer.bytes,
+                                                                written.unwrap());
+
+        THEN("the error is read back") {
+            REQUIRE(view.unwrap().has_error());
+            REQUIRE(view.unwrap().unwrap_error() == ErrorCode::NotFound);
+        }
+    }
+
+    WHEN("an Optional is round tripped") {
+        const auto written_value = monads::serialize(monads::make_optional<int>(42),
+                                                     buffer.bytes, sizeof(buffer.bytes));
+        const auto value = monads::view_optional<int>(buffer.bytes, written_value.unwrap());
+        const int read = *value.unwrap();
+
+        monads::serialize(monads::Optional<int>{ }, buffer.bytes, sizeof(buffer.bytes));
+        const auto empty = monads::view_optional<int>(buffer.bytes, written_value.unwrap());
+
+        THEN("both states are read back") {
+            REQUIRE(read == 42);
+            REQUIRE(empty.has_value());
+            REQUIRE_FALSE(empty.unwrap().has_value());
+            REQUIRE_FALSE(empty.unwrap().to_optional().has_value());
+        }
+    }
+
+    WHEN("the buffer does not match the requested layout") {
+        const auto expected = monads::make_expected<Row, ErrorCode>(Row{ 1, 2.0, "x" });
+        const std::size_t size =
+            monads::serialize(expected, buffer.bytes, sizeof(buffer.bytes)).unwrap();
+
+        THEN("the reader reports why") {
+            using monads::SerializationError;
+
+            REQUIRE(monads::serialize(expected, buffer.bytes, size - 1).unwrap_error()
+                    == SerializationError::BufferTooSmall);
+            REQUIRE(monads::view_expected<Row, ErrorCode>(buffer.bytes, size - 1)
+                        .unwrap_error() == SerializationError::BufferTooSmall);
+            REQUIRE(monads::view_expected<Row, int>(buffer.bytes, size).unwrap_error()
+                    == SerializationError::LayoutMismatch);
+            REQUIRE(monads::view_optional<Row>(buffer.bytes, size).unwrap_error()
+                    == SerializationError::LayoutMismatch);
+            REQUIRE(monads::view_expected<Row, ErrorCode>(buffer.bytes + 1, size)
+                        .unwrap_error() == SerializationError::Misaligned);
+
+            std::swap(buffer.bytes[0], buffer.bytes[3]);
+            std::swap(buffer.bytes[1], buffer.bytes[2]);
+            REQUIRE(monads::view_expected<Row, ErrorCode>(buffer.bytes, size)
+                        .unwrap_error() == SerializationError::ByteOrderMismatch);
+
+            buffer.bytes[0] = 0;
+            REQUIRE(monads::view_expected<Row, ErrorCode>(buffer.bytes, size)
+                        .unwrap_error() == SerializationError::BadMagic);
+        }
+    }
+
+    WHEN("serialized records are randomly corrupted") {
+        const auto expected = monads::make_unexpected<Row, ErrorCode>(ErrorCode::Internal);
+        const std::size_t size =
+            monads::serialize(expected, buffer.bytes, sizeof(buffer.bytes)).unwrap();
+        const Buffer original = buffer;
+
+        std::mt19937 engine{ 20181109 };
+        std::uniform_int_distribution<std::size_t> position{ 0, size - 1 };
+        std::uniform_int_distribution<int> byte{ 0, 255 };
+
+        std::size_t accepted = 0;
+        bool consistent = true;
+
+        for (int i = 0; i < 10000; ++i) {
+            buffer = original;
+
+            for (int flips = i % 4 + 1; flips > 0; --flips) {
+                buffer.bytes[position(engine)] = static_cast<unsigned char>(byte(engine));
+            }
+
+            const auto view = monads::view_expected<Row, ErrorCode>(buffer.bytes, size);
+
+            if (view.has_value()) {
+                ++accepted;
+
+                const auto &record = view.unwrap();
+                consistent = consistent && !(record.has_value() && record.has_error());
+            }
+        }
+
+        THEN("the reader never accepts an invalid header or state") {
+            REQUIRE(consistent);
+            REQUIRE(accepted > 0);
+            REQUIRE(accepted < 10000);
+        }
+    }
+}
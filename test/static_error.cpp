@@ -0,0 +1,129 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/static_error.hpp>
+
+#include "catch.hpp"
+
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace {
+
+MONADS_STATIC_ERROR(quota_exceeded, "quota exceeded", 429, "http");
+
+monads::Expected<int, monads::StaticError> lookup(int key) {
+    if (key < 0) {
+        return monads::make_unexpected<int>(monads::errors::invalid_argument);
+    } else if (key > 9) {
+        return monads::make_unexpected<int>(monads::errors::not_found);
+    }
+
+    return { key * key };
+}
+
+monads::Expected<int, monads::StaticError> lookup_twice(int key) {
+    const auto first = lookup(key);
+
+    if (!first.has_value()) {
+        return first;
+    }
+
+    return lookup(first.unwrap());
+}
+
+constexpr monads::Expected<int, monads::StaticError> timed_out =
+    monads::make_unexpected<int>(monads::errors::timeout);
+
+} // namespace
+
+static_assert(
+    sizeof(monads::StaticError) == sizeof(void*),
+    "a StaticError is a single pointer"
+);
+
+static_assert(
+    std::is_trivially_copyable<monads::StaticError>::value,
+    "propagating a StaticError copies a pointer"
+);
+
+static_assert(
+    timed_out.unwrap_error() == monads::errors::timeout,
+    "StaticErrors can be created and compared in constant expressions"
+);
+
+static_assert(
+    monads::errors::timeout.code() == static_cast<int>(std::errc::timed_out),
+    "descriptors are available at compile time"
+);
+
+SCENARIO(
+    "monads::StaticError",
+    "[monads][monads/static_error.hpp][monads::StaticError]"
+) {
+    GIVEN("a StaticError for a built-in descriptor") {
+        const monads::StaticError error = monads::errors::not_found;
+
+        THEN("it exposes the descriptor") {
+            using namespace std::literals;
+
+            REQUIRE(error.name() == "not found"s);
+            REQUIRE(error.what() == "not found"s);
+            REQUIRE(error.code() == static_cast<int>(std::errc::no_such_file_or_directory));
+            REQUIRE(error.category() == "generic"s);
+        }
+
+        THEN("it compares equal only to handles to the same descriptor") {
+            REQUIRE(error == monads::errors::not_found);
+            REQUIRE(error != monads::errors::timeout);
+            REQUIRE(&error.descriptor() == &monads::errors::not_found.descriptor());
+        }
+    }
+
+    GIVEN("a user-declared descriptor") {
+        THEN("it is interned like the built-in ones") {
+            using namespace std::literals;
+
+            REQUIRE(quota_exceeded.code() == 429);
+            REQUIRE(quota_exceeded.category() == "http"s);
+            REQUIRE(quota_exceeded != monads::errors::not_found);
+        }
+    }
+
+    GIVEN("functions that return a StaticError") {
+        THEN("the error is propagated unchanged") {
+            REQUIRE(lookup_twice(2).unwrap() == 16);
+            REQUIRE(lookup_twice(-1).unwrap_error() == monads::errors::invalid_argument);
+            REQUIRE(lookup_twice(5).unwrap_error() == monads::errors::not_found);
+        }
+    }
+}
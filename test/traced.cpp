@@ -0,0 +1,116 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/traced.hpp>
+
+#include "catch.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+SCENARIO(
+    "monads::Traced",
+    "[monads][monads/traced.hpp][monads::Traced]"
+) {
+    monads::set_trace_sample_rate(1);
+
+    WHEN("a traced error is constructed by make_unexpected") {
+        const auto result = monads::make_unexpected<int, monads::Traced<std::string>>(
+            "oh no"
+        );
+
+        THEN("it captures a stack trace that can be symbolized later") {
+            REQUIRE(result.has_error());
+            REQUIRE(result.unwrap_error().error() == "oh no");
+            REQUIRE(result.unwrap_error().has_trace());
+
+            const monads::StackTrace &trace = *result.unwrap_error().trace();
+            const std::vector<monads::StackFrame> frames = trace.symbolize();
+
+#ifdef MONADS_HAS_FRAME_POINTER_WALK
+            REQUIRE_FALSE(trace.empty());
+#endif
+            REQUIRE(frames.size() == trace.size());
+
+            for (const monads::StackFrame &frame : frames) {
+                REQUIRE(frame.address != nullptr);
+            }
+        }
+
+        THEN("copies share the trace") {
+            const auto copy = result;
+
+            REQUIRE(copy.unwrap_error().trace() == result.unwrap_error().trace());
+        }
+    }
+
+    WHEN("try_invoke catches a traced error") {
+        const auto result = monads::try_invoke<monads::Traced<std::runtime_error>>(
+            []() -> int {
+                throw std::runtime_error{ "failed" };
+            }
+        );
+
+        THEN("the error and its trace are stored") {
+            using namespace std::literals;
+
+            REQUIRE(result.has_error());
+            REQUIRE(result.unwrap_error().error().what() == "failed"s);
+            REQUIRE(result.unwrap_error().has_trace());
+        }
+    }
+
+    WHEN("traces are sampled") {
+        monads::set_trace_sample_rate(4);
+
+        int traced = 0;
+
+        for (int i = 0; i < 16; ++i) {
+            const monads::Traced<int> error{ i };
+
+            if (error.has_trace()) {
+                ++traced;
+            }
+        }
+
+        monads::set_trace_sample_rate(0);
+
+        const monads::Traced<int> untraced{ 0 };
+
+        monads::set_trace_sample_rate(1);
+
+        THEN("only one in every N errors captures a trace") {
+            REQUIRE(traced == 4);
+            REQUIRE_FALSE(untraced.has_trace());
+        }
+    }
+}
@@ -0,0 +1,168 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/validated.hpp>
+
+#include "catch.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+struct Person {
+    std::string name;
+    int age;
+};
+
+using ValidatedName = monads::Validated<std::string, std::string>;
+using ValidatedAge = monads::Validated<int, std::string>;
+
+ValidatedName validate_name(const std::string &name) {
+    if (name.empty()) {
+        return monads::make_invalid<std::string, std::string>("name is empty");
+    }
+
+    return monads::make_valid<std::string, std::string>(name);
+}
+
+ValidatedAge validate_age(int age) {
+    if (age < 0) {
+        return monads::make_invalid<int, std::string>("age is negative");
+    }
+
+    return monads::make_valid<int, std::string>(age);
+}
+
+Person make_person(const std::string &name, int age) {
+    return Person{ name, age };
+}
+
+struct CheckedAge {
+    explicit CheckedAge(int age) : value{ age } {
+        if (age < 0) {
+            throw std::invalid_argument{ "age is negative" };
+        }
+    }
+
+    int value;
+};
+
+} // namespace
+
+SCENARIO(
+    "monads::Validated",
+    "[monads][monads/validated.hpp][monads::Validated]"
+) {
+    WHEN("every check passes") {
+        const auto person = monads::combine(make_person, validate_name("Alice"),
+                                            validate_age(30));
+
+        THEN("the combining function is applied to every value") {
+            REQUIRE(person.has_value());
+            REQUIRE(person.unwrap().name == "Alice");
+            REQUIRE(person.unwrap().age == 30);
+            REQUIRE_THROWS_AS(person.errors(), monads::BadExpectedAccess);
+        }
+    }
+
+    WHEN("several checks fail") {
+        const auto person = monads::combine(make_person, validate_name(""),
+                                            validate_age(-1));
+
+        THEN("every error is reported without allocating") {
+            REQUIRE(person.has_error());
+            REQUIRE_THROWS_AS(person.value(), monads::BadExpectedAccess);
+
+            const auto &errors = person.unwrap_errors();
+
+            REQUIRE(errors.size() == 2);
+            REQUIRE(errors.is_inline());
+            REQUIRE(errors[0] == "name is empty");
+            REQUIRE(errors[1] == "age is negative");
+        }
+    }
+
+    WHEN("more errors are accumulated than fit inline") {
+        const auto sum = monads::combine(
+            [](int a, int b, int c, int d, int e, int f) {
+                return a + b + c + d + e + f;
+            },
+            validate_age(-1), validate_age(-2), validate_age(3),
+            validate_age(-4), validate_age(-5), validate_age(-6)
+        );
+
+        THEN("the errors spill to the heap in order") {
+            REQUIRE(sum.has_error());
+            REQUIRE(sum.unwrap_errors().size() == 5);
+            REQUIRE_FALSE(sum.unwrap_errors().is_inline());
+        }
+    }
+
+    WHEN("converting from and to Expected") {
+        const ValidatedAge valid = monads::Expected<int, std::string>{
+            monads::InPlaceValueType{ }, 5
+        };
+        const ValidatedAge invalid = monads::Expected<int, std::string>{
+            monads::InPlaceErrorType{ }, "bad age"
+        };
+
+        THEN("the state and payload are preserved") {
+            REQUIRE(valid.unwrap() == 5);
+            REQUIRE(invalid.unwrap_errors().size() == 1);
+            REQUIRE(invalid.unwrap_errors().front() == "bad age");
+
+            const auto &expected = invalid.to_expected();
+
+            REQUIRE(expected.has_error());
+            REQUIRE(expected.unwrap_error().front() == "bad age");
+            REQUIRE(valid.map([](int x) { return x * 2; }).unwrap() == 10);
+        }
+    }
+
+    WHEN("converting from an Expected left valueless by a throwing emplace") {
+        using Checked = monads::Validated<CheckedAge, std::string>;
+
+        monads::Expected<CheckedAge, std::string> valueless{
+            monads::InPlaceErrorType{ }, "bad age"
+        };
+
+        REQUIRE_THROWS_AS(valueless.emplace(-1), std::invalid_argument);
+
+        THEN("it is rejected instead of becoming an empty error list") {
+            REQUIRE_FALSE(valueless.has_value());
+            REQUIRE_FALSE(valueless.has_error());
+            REQUIRE_THROWS_AS(Checked{ valueless }, monads::BadExpectedAccess);
+            REQUIRE_THROWS_AS(Checked{ std::move(valueless) }, monads::BadExpectedAccess);
+        }
+    }
+}
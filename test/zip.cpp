@@ -0,0 +1,131 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2018, Gregory Meyer
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS AS IS
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <monads/zip.hpp>
+
+#include "catch.hpp"
+
+#include <memory>
+#include <string>
+#include <tuple>
+
+SCENARIO(
+    "monads::zip and monads::zip_with for Optional",
+    "[monads][monads/zip.hpp][monads::zip][monads::Optional]"
+) {
+    const monads::Optional<int> one{ 1 };
+    const monads::Optional<double> two{ 2.5 };
+    const monads::Optional<std::string> three{ monads::InPlaceType{ }, "three" };
+    const monads::Optional<int> none;
+
+    WHEN("every Optional is engaged") {
+        const auto zipped = monads::zip(one, two, three);
+
+        THEN("the values are zipped into a tuple") {
+            REQUIRE(zipped.has_value());
+            REQUIRE(*zipped == std::make_tuple(1, 2.5, std::string{ "three" }));
+        }
+
+        THEN("zip_with invokes the callable with every value") {
+            const auto sum = monads::zip_with([](int a, double b, int c) { return a + b + c; },
+                                              one, two, one);
+
+            REQUIRE(*sum == 4.5);
+        }
+    }
+
+    WHEN("any Optional is empty") {
+        int calls = 0;
+        const auto sum = monads::zip_with([&calls](int a, int b) {
+            ++calls;
+
+            return a + b;
+        }, one, none);
+
+        THEN("the result is empty and the callable is not invoked") {
+            REQUIRE_FALSE(monads::zip(one, two, none).has_value());
+            REQUIRE_FALSE(sum.has_value());
+            REQUIRE(calls == 0);
+        }
+    }
+
+    WHEN("rvalue Optionals are zipped") {
+        monads::Optional<std::unique_ptr<int>> owned{ monads::InPlaceType{ }, new int{ 7 } };
+        const auto zipped = monads::zip(std::move(owned), monads::Optional<int>{ 3 });
+
+        THEN("their values are moved into the tuple") {
+            REQUIRE(*std::get<0>(*zipped) == 7);
+            REQUIRE(std::get<1>(*zipped) == 3);
+        }
+    }
+
+    WHEN("zip is evaluated at compile time") {
+        constexpr auto zipped = monads::zip(monads::Optional<int>{ 1 }, monads::Optional<int>{ 2 });
+
+        THEN("it produces a constant") {
+            static_assert(std::get<1>(*zipped) == 2, "zip must be usable in constant expressions");
+        }
+    }
+}
+
+SCENARIO(
+    "monads::zip and monads::zip_with for Expected",
+    "[monads][monads/zip.hpp][monads::zip][monads::Expected]"
+) {
+    using IntResult = monads::Expected<int, std::string>;
+    using DoubleResult = monads::Expected<double, std::string>;
+
+    const IntResult one{ monads::InPlaceValueType{ }, 1 };
+    const DoubleResult two{ monads::InPlaceValueType{ }, 2.5 };
+    const IntResult first_error{ monads::InPlaceErrorType{ }, "first" };
+    const DoubleResult second_error{ monads::InPlaceErrorType{ }, "second" };
+
+    WHEN("every Expected holds a value") {
+        const auto zipped = monads::zip(one, two, one);
+        const auto product = monads::zip_with([](int a, double b) { return a * b; }, one, two);
+
+        THEN("the values are combined") {
+            REQUIRE(zipped.unwrap() == std::make_tuple(1, 2.5, 1));
+            REQUIRE(product.unwrap() == 2.5);
+        }
+    }
+
+    WHEN("several Expecteds hold errors") {
+        const auto zipped = monads::zip(one, second_error, first_error);
+        const auto sum = monads::zip_with([](int a, int b) { return a + b; },
+                                          first_error, IntResult{ monads::InPlaceErrorType{ }, "x" });
+
+        THEN("the first error in argument order is returned") {
+            REQUIRE(zipped.unwrap_error() == "second");
+            REQUIRE(sum.unwrap_error() == "first");
+        }
+    }
+}